@@ -0,0 +1,269 @@
+/**
+ * @file Asset_Store.c
+ *
+ * @brief Source code for the Asset_Store module.
+ *
+ * This file contains the function definitions for the Asset_Store module.
+ * It reads assets (e.g. menus, glyph sets, melodies and PCM clips) from an external flash device by asset ID,
+ * through a least recently used (LRU) block cache with read-ahead.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Asset_Store.h"
+
+#include <string.h>
+
+// Size of the header and of each entry of the index table (in bytes)
+#define INDEX_HEADER_SIZE   8
+#define INDEX_ENTRY_SIZE    12
+
+// Address of a cache block that does not hold any data
+#define BLOCK_INVALID       0xFFFFFFFF
+
+#define BLOCK_MASK          (ASSET_STORE_BLOCK_SIZE - 1)
+
+static const Asset_Flash* asset_flash = 0;
+static uint32_t asset_count = 0;
+
+static uint8_t cache_data[ASSET_STORE_CACHE_BLOCKS][ASSET_STORE_BLOCK_SIZE];
+static uint32_t cache_addresses[ASSET_STORE_CACHE_BLOCKS];
+static uint32_t cache_last_use[ASSET_STORE_CACHE_BLOCKS];
+static uint32_t use_counter = 0;
+
+static uint32_t prefetch_address = BLOCK_INVALID;
+
+static uint32_t hit_count = 0;
+static uint32_t miss_count = 0;
+static uint32_t prefetch_count = 0;
+
+// Returns the index of the cache block holding the specified block address, or ASSET_STORE_CACHE_BLOCKS if it is not cached
+static uint8_t Asset_Store_Find_Block(uint32_t block_address)
+{
+	for (uint8_t i = 0; i < ASSET_STORE_CACHE_BLOCKS; i++)
+	{
+		if (cache_addresses[i] == block_address) return i;
+	}
+
+	return ASSET_STORE_CACHE_BLOCKS;
+}
+
+// Reads a block from the flash into the least recently used cache block and returns its index
+static uint8_t Asset_Store_Load_Block(uint32_t block_address)
+{
+	uint8_t victim = 0;
+
+	for (uint8_t i = 1; i < ASSET_STORE_CACHE_BLOCKS; i++)
+	{
+		if (cache_last_use[i] < cache_last_use[victim])
+		{
+			victim = i;
+		}
+	}
+
+	// The last block of the flash may be shorter than a cache block
+	uint32_t length = ASSET_STORE_BLOCK_SIZE;
+	if (block_address + length > asset_flash->size)
+	{
+		length = asset_flash->size - block_address;
+	}
+
+	asset_flash->Read(block_address, cache_data[victim], length);
+	cache_addresses[victim] = block_address;
+
+	return victim;
+}
+
+// Returns the cache block holding the specified block address, reading it from the flash if needed
+static uint8_t* Asset_Store_Get_Block(uint32_t block_address)
+{
+	uint8_t block = Asset_Store_Find_Block(block_address);
+
+	if (block < ASSET_STORE_CACHE_BLOCKS)
+	{
+		hit_count = hit_count + 1;
+	}
+	else
+	{
+		block = Asset_Store_Load_Block(block_address);
+		miss_count = miss_count + 1;
+	}
+
+	use_counter = use_counter + 1;
+	cache_last_use[block] = use_counter;
+
+	return cache_data[block];
+}
+
+// Copies bytes from the flash through the cache
+static void Asset_Store_Read_Cached(uint32_t address, uint8_t* buffer, uint32_t length)
+{
+	while (length > 0)
+	{
+		uint32_t offset = address & BLOCK_MASK;
+		uint32_t count = ASSET_STORE_BLOCK_SIZE - offset;
+
+		if (count > length)
+		{
+			count = length;
+		}
+
+		memcpy(buffer, Asset_Store_Get_Block(address & ~BLOCK_MASK) + offset, count);
+
+		address = address + count;
+		buffer = buffer + count;
+		length = length - count;
+	}
+}
+
+// Reads a little-endian word from the flash through the cache
+static uint32_t Asset_Store_Read_Word(uint32_t address)
+{
+	uint8_t bytes[4];
+
+	Asset_Store_Read_Cached(address, bytes, 4);
+
+	return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+uint8_t Asset_Store_Init(const Asset_Flash* flash)
+{
+	asset_flash = flash;
+	asset_count = 0;
+	use_counter = 0;
+	prefetch_address = BLOCK_INVALID;
+	hit_count = 0;
+	miss_count = 0;
+	prefetch_count = 0;
+
+	for (uint8_t i = 0; i < ASSET_STORE_CACHE_BLOCKS; i++)
+	{
+		cache_addresses[i] = BLOCK_INVALID;
+		cache_last_use[i] = 0;
+	}
+
+	if (flash == 0 || flash->size < INDEX_HEADER_SIZE) return 0;
+
+	if (Asset_Store_Read_Word(0) != ASSET_STORE_MAGIC) return 0;
+
+	// Reject an index table that does not fit in the flash (e.g. erased flash)
+	uint32_t count = Asset_Store_Read_Word(4);
+	if (count > (flash->size - INDEX_HEADER_SIZE) / INDEX_ENTRY_SIZE) return 0;
+
+	asset_count = count;
+	return 1;
+}
+
+uint32_t Asset_Store_Get_Count(void)
+{
+	return asset_count;
+}
+
+uint32_t Asset_Store_Get_ID(uint32_t index)
+{
+	if (index >= asset_count) return 0xFFFFFFFF;
+
+	return Asset_Store_Read_Word(INDEX_HEADER_SIZE + (index * INDEX_ENTRY_SIZE));
+}
+
+uint8_t Asset_Store_Open(uint32_t id, Asset_Handle* handle)
+{
+	uint32_t low = 0;
+	uint32_t high = asset_count;
+
+	while (low < high)
+	{
+		uint32_t middle = low + ((high - low) / 2);
+		uint32_t entry = INDEX_HEADER_SIZE + (middle * INDEX_ENTRY_SIZE);
+		uint32_t entry_id = Asset_Store_Read_Word(entry);
+
+		if (entry_id == id)
+		{
+			uint32_t address = Asset_Store_Read_Word(entry + 4);
+			uint32_t length = Asset_Store_Read_Word(entry + 8);
+
+			// Reject an entry that points outside of the flash
+			if (address > asset_flash->size || length > asset_flash->size - address) return 0;
+
+			handle->id = id;
+			handle->address = address;
+			handle->length = length;
+			handle->position = 0;
+			return 1;
+		}
+
+		if (entry_id < id)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			high = middle;
+		}
+	}
+
+	return 0;
+}
+
+uint32_t Asset_Store_Read(Asset_Handle* handle, uint8_t* buffer, uint32_t length)
+{
+	uint32_t remaining = handle->length - handle->position;
+
+	if (length > remaining)
+	{
+		length = remaining;
+	}
+
+	uint32_t address = handle->address + handle->position;
+	Asset_Store_Read_Cached(address, buffer, length);
+	handle->position = handle->position + length;
+
+	// Mark the block after the last one read for read-ahead if the asset continues into it
+	uint32_t next_block = ((address + length - 1) & ~BLOCK_MASK) + ASSET_STORE_BLOCK_SIZE;
+
+	if (length > 0 && next_block < handle->address + handle->length)
+	{
+		prefetch_address = next_block;
+	}
+
+	return length;
+}
+
+void Asset_Store_Seek(Asset_Handle* handle, uint32_t position)
+{
+	handle->position = (position < handle->length) ? position : handle->length;
+}
+
+uint8_t Asset_Store_Prefetch(void)
+{
+	if (prefetch_address == BLOCK_INVALID) return 0;
+
+	uint32_t block_address = prefetch_address;
+	prefetch_address = BLOCK_INVALID;
+
+	if (Asset_Store_Find_Block(block_address) < ASSET_STORE_CACHE_BLOCKS) return 0;
+
+	uint8_t block = Asset_Store_Load_Block(block_address);
+
+	// Treat the block as recently used so that it is not replaced before it is read
+	use_counter = use_counter + 1;
+	cache_last_use[block] = use_counter;
+	prefetch_count = prefetch_count + 1;
+
+	return 1;
+}
+
+uint32_t Asset_Store_Get_Hit_Count(void)
+{
+	return hit_count;
+}
+
+uint32_t Asset_Store_Get_Miss_Count(void)
+{
+	return miss_count;
+}
+
+uint32_t Asset_Store_Get_Prefetch_Count(void)
+{
+	return prefetch_count;
+}
@@ -0,0 +1,163 @@
+/**
+ * @file Asset_Store.h
+ *
+ * @brief Header file for the Asset_Store module.
+ *
+ * This file contains the function definitions for the Asset_Store module.
+ * It reads assets (e.g. menus, glyph sets, melodies and PCM clips) from an external flash device by asset ID,
+ * so that they do not need to be stored in the internal flash of the TM4C123GH6PM.
+ *
+ * The flash image starts with an index table, which is generated by Tools/build_asset_image.py:
+ *  - Word 0: ASSET_STORE_MAGIC
+ *  - Word 1: Number of assets
+ *  - Followed by one entry per asset, sorted by ID: ID, address of the data and length in bytes (one word each)
+ *
+ * All words are stored in little-endian byte order. The flash is read through a cache of ASSET_STORE_CACHE_BLOCKS
+ * blocks of ASSET_STORE_BLOCK_SIZE bytes in SRAM. When the cache is full, the least recently used block is replaced.
+ * The index entries are also read through the cache, so the blocks of the index that are searched often stay cached.
+ *
+ * Assets are read sequentially through a handle. After each read, the next block of the asset is marked for read-ahead,
+ * and Asset_Store_Prefetch loads it into the cache when the main loop is idle. An asset that is streamed slower than
+ * the flash can be read is then always read from the cache.
+ *
+ * The module does not access any register. The flash device is selected with an Asset_Flash structure,
+ * so the module can be compiled on the host with a file-backed flash model (see Tools/asset_store_host.c)
+ * or on the target with the SPI_Flash driver.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include <stdint.h>
+
+// Identifies a valid flash image ("ASST")
+#define ASSET_STORE_MAGIC           0x54535341
+
+// Size of each cached block (in bytes). It must be a power of two
+#define ASSET_STORE_BLOCK_SIZE      256
+
+// Number of blocks in the cache
+#define ASSET_STORE_CACHE_BLOCKS    8
+
+typedef struct
+{
+	// Size of the flash device (in bytes)
+	uint32_t size;
+
+	// Reads length bytes starting at address into buffer
+	void (*Read)(uint32_t address, uint8_t* buffer, uint32_t length);
+} Asset_Flash;
+
+typedef struct
+{
+	uint32_t id;
+	uint32_t address;
+	uint32_t length;
+	uint32_t position;
+} Asset_Handle;
+
+// External SPI NOR flash on the EduBase Board SSI2 bus (see SPI_Flash.h)
+extern const Asset_Flash SPI_Flash_Asset_Flash;
+
+/**
+ * @brief Selects the flash device, clears the cache, and checks the index table.
+ *
+ * @param flash A pointer to the flash device.
+ *
+ * @return Returns 1 if the flash contains a valid image. Otherwise, it returns 0 and no asset can be opened.
+ */
+uint8_t Asset_Store_Init(const Asset_Flash* flash);
+
+/**
+ * @brief Returns the number of assets in the index table.
+ *
+ * @param None
+ *
+ * @return The number of assets, or 0 if the image is not valid.
+ */
+uint32_t Asset_Store_Get_Count(void);
+
+/**
+ * @brief Returns the ID of an asset from its position in the index table.
+ *
+ * @param index The position of the asset in the index table (0 to Asset_Store_Get_Count() - 1).
+ *
+ * @return The ID of the asset, or 0xFFFFFFFF if the index is not valid.
+ */
+uint32_t Asset_Store_Get_ID(uint32_t index);
+
+/**
+ * @brief Opens an asset and sets the position of the handle to the start of the asset.
+ *
+ * The index table is searched with a binary search.
+ *
+ * @param id The ID of the asset.
+ *
+ * @param handle A pointer to the handle to be initialized.
+ *
+ * @return Returns 1 if the asset was found. Otherwise, it returns 0.
+ */
+uint8_t Asset_Store_Open(uint32_t id, Asset_Handle* handle);
+
+/**
+ * @brief Reads the next bytes of an asset and advances the position of the handle.
+ *
+ * The next block of the asset is marked for read-ahead.
+ *
+ * @param handle A pointer to the handle of the asset.
+ *
+ * @param buffer A pointer to the buffer that receives the data.
+ *
+ * @param length The number of bytes to be read.
+ *
+ * @return The number of bytes read, which is less than length at the end of the asset.
+ */
+uint32_t Asset_Store_Read(Asset_Handle* handle, uint8_t* buffer, uint32_t length);
+
+/**
+ * @brief Sets the position of the handle.
+ *
+ * @param handle A pointer to the handle of the asset.
+ *
+ * @param position The offset from the start of the asset (in bytes). It is limited to the length of the asset.
+ *
+ * @return None
+ */
+void Asset_Store_Seek(Asset_Handle* handle, uint32_t position);
+
+/**
+ * @brief Loads the block marked for read-ahead into the cache.
+ *
+ * This function should be called when the main loop is idle.
+ *
+ * @param None
+ *
+ * @return Returns 1 if a block was read from the flash. Otherwise, it returns 0.
+ */
+uint8_t Asset_Store_Prefetch(void);
+
+/**
+ * @brief Returns the number of blocks that were found in the cache.
+ *
+ * @param None
+ *
+ * @return The number of cache hits since initialization.
+ */
+uint32_t Asset_Store_Get_Hit_Count(void);
+
+/**
+ * @brief Returns the number of blocks that were read from the flash while reading an asset or the index.
+ *
+ * @param None
+ *
+ * @return The number of cache misses since initialization.
+ */
+uint32_t Asset_Store_Get_Miss_Count(void);
+
+/**
+ * @brief Returns the number of blocks that were read from the flash by Asset_Store_Prefetch.
+ *
+ * @param None
+ *
+ * @return The number of read-ahead blocks since initialization.
+ */
+uint32_t Asset_Store_Get_Prefetch_Count(void);
@@ -14,6 +14,7 @@
  */
  
 #include "Buzzer.h"
+#include "Clock_Manager.h"
 
 // Constant definitions for the buzzer
 const uint8_t BUZZER_OFF 		= 0x00;
@@ -32,23 +33,26 @@ const double C5_NOTE = 523.2;
 
 void Buzzer_Init(void)
 {
+	// Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
 	// Enable the clock to Port C
-	SYSCTL->RCGCGPIO |= 0x04;
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_C);
 	
 	// Set PC4 as an output GPIO pin
-	GPIOC->DIR |= 0x10;
+	GPIO_PORT_C->DIR |= 0x10;
 	
 	// Configure PC4 to function as a GPIO pin
-	GPIOC->AFSEL &= ~0x10;
+	GPIO_PORT_C->AFSEL &= ~0x10;
 	
 	// Enable digital functionality for PC4
-	GPIOC->DEN |= 0x10;
+	GPIO_PORT_C->DEN |= 0x10;
 }
  
 void Buzzer_Output(uint8_t buzzer_value)
 {
 	// Set the output of the buzzer
-	GPIOC->DATA = (GPIOC->DATA & 0xEF) | buzzer_value;
+	GPIO_PORT_C->DATA = (GPIO_PORT_C->DATA & 0xEF) | buzzer_value;
 }
 
 void Play_Note(double note, unsigned int duration)
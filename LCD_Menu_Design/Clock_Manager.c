@@ -0,0 +1,114 @@
+/**
+ * @file Clock_Manager.c
+ *
+ * @brief Source code for the Clock_Manager driver.
+ *
+ * This file contains the function definitions for the Clock_Manager driver.
+ * It keeps a reference count for the run-mode clock of each peripheral instance
+ * (RCGCGPIO, RCGCTIMER, RCGCWTIMER, RCGCSSI, RCGCPWM, RCGCDMA, RCGCEEPROM and RCGCUART registers).
+ *
+ * A driver acquires the clocks it needs before accessing a peripheral and releases them when it is no longer
+ * used. The clock is enabled when the first reference is acquired, and the corresponding Peripheral Ready (PR)
+ * register is polled until the peripheral can be accessed. The clock is gated when the last reference is released.
+ * Several drivers can share a GPIO port without gating it for each other.
+ *
+ * @note The registers of a peripheral keep their values while its clock is gated.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Clock_Manager.h"
+
+static uint8_t clock_reference_counts[CLOCK_PERIPHERAL_COUNT][CLOCK_MANAGER_MAX_INSTANCES];
+
+static volatile uint32_t* Clock_Manager_Get_RCGC(uint8_t peripheral)
+{
+	switch(peripheral)
+	{
+		case CLOCK_GPIO:        return &SYSCTL->RCGCGPIO;
+		case CLOCK_TIMER:       return &SYSCTL->RCGCTIMER;
+		case CLOCK_WIDE_TIMER:  return &SYSCTL->RCGCWTIMER;
+		case CLOCK_SSI:         return &SYSCTL->RCGCSSI;
+		case CLOCK_PWM:         return &SYSCTL->RCGCPWM;
+		case CLOCK_DMA:         return &SYSCTL->RCGCDMA;
+		case CLOCK_EEPROM:      return &SYSCTL->RCGCEEPROM;
+		default:                return &SYSCTL->RCGCUART;
+	}
+}
+
+static volatile uint32_t* Clock_Manager_Get_PR(uint8_t peripheral)
+{
+	switch(peripheral)
+	{
+		case CLOCK_GPIO:        return &SYSCTL->PRGPIO;
+		case CLOCK_TIMER:       return &SYSCTL->PRTIMER;
+		case CLOCK_WIDE_TIMER:  return &SYSCTL->PRWTIMER;
+		case CLOCK_SSI:         return &SYSCTL->PRSSI;
+		case CLOCK_PWM:         return &SYSCTL->PRPWM;
+		case CLOCK_DMA:         return &SYSCTL->PRDMA;
+		case CLOCK_EEPROM:      return &SYSCTL->PREEPROM;
+		default:                return &SYSCTL->PRUART;
+	}
+}
+
+uint8_t Clock_Manager_Acquire(uint8_t peripheral, uint8_t instance)
+{
+	if (peripheral >= CLOCK_PERIPHERAL_COUNT || instance >= CLOCK_MANAGER_MAX_INSTANCES) return 0;
+
+	// The reference counts can be updated from interrupt service routines
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	uint8_t* count = &clock_reference_counts[peripheral][instance];
+
+	// The reference count cannot be incremented any further
+	// A capped count would gate the clock while references are still held
+	if (*count == 0xFF)
+	{
+		__set_PRIMASK(primask);
+		return 0;
+	}
+
+	if (*count == 0)
+	{
+		// Enable the clock and wait until the peripheral is ready to be accessed
+		*Clock_Manager_Get_RCGC(peripheral) |= (1UL << instance);
+		while ((*Clock_Manager_Get_PR(peripheral) & (1UL << instance)) == 0);
+	}
+
+	*count = *count + 1;
+
+	__set_PRIMASK(primask);
+
+	return 1;
+}
+
+void Clock_Manager_Release(uint8_t peripheral, uint8_t instance)
+{
+	if (peripheral >= CLOCK_PERIPHERAL_COUNT || instance >= CLOCK_MANAGER_MAX_INSTANCES) return;
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	uint8_t* count = &clock_reference_counts[peripheral][instance];
+
+	if (*count > 0)
+	{
+		*count = *count - 1;
+
+		// Gate the clock when the last reference is released
+		if (*count == 0)
+		{
+			*Clock_Manager_Get_RCGC(peripheral) &= ~(1UL << instance);
+		}
+	}
+
+	__set_PRIMASK(primask);
+}
+
+uint8_t Clock_Manager_Get_Count(uint8_t peripheral, uint8_t instance)
+{
+	if (peripheral >= CLOCK_PERIPHERAL_COUNT || instance >= CLOCK_MANAGER_MAX_INSTANCES) return 0;
+
+	return clock_reference_counts[peripheral][instance];
+}
@@ -0,0 +1,91 @@
+/**
+ * @file Clock_Manager.h
+ *
+ * @brief Header file for the Clock_Manager driver.
+ *
+ * This file contains the function definitions for the Clock_Manager driver.
+ * It keeps a reference count for the run-mode clock of each peripheral instance
+ * (RCGCGPIO, RCGCTIMER, RCGCWTIMER, RCGCSSI, RCGCPWM, RCGCDMA, RCGCEEPROM and RCGCUART registers).
+ *
+ * A driver acquires the clocks it needs before accessing a peripheral and releases them when it is no longer
+ * used. The clock is enabled when the first reference is acquired, and the corresponding Peripheral Ready (PR)
+ * register is polled until the peripheral can be accessed. The clock is gated when the last reference is released.
+ * Several drivers can share a GPIO port without gating it for each other.
+ *
+ * The EduBase_LCD_DMA, Profiler and Settings drivers release their clocks while they are idle.
+ * The other drivers keep their references for the lifetime of the program because their
+ * peripherals keep driving pins or generating interrupts once they have been initialized.
+ *
+ * @note The registers of a peripheral keep their values while its clock is gated.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+#define CLOCK_MANAGER_MAX_INSTANCES     8
+
+enum Clock_Peripherals
+{
+	CLOCK_GPIO              = 0x00,
+	CLOCK_TIMER             = 0x01,
+	CLOCK_WIDE_TIMER        = 0x02,
+	CLOCK_SSI               = 0x03,
+	CLOCK_PWM               = 0x04,
+	CLOCK_DMA               = 0x05,
+	CLOCK_EEPROM            = 0x06,
+	CLOCK_UART              = 0x07,
+	CLOCK_PERIPHERAL_COUNT  = 0x08
+};
+
+enum Clock_GPIO_Ports
+{
+	CLOCK_GPIO_PORT_A       = 0x00,
+	CLOCK_GPIO_PORT_B       = 0x01,
+	CLOCK_GPIO_PORT_C       = 0x02,
+	CLOCK_GPIO_PORT_D       = 0x03,
+	CLOCK_GPIO_PORT_E       = 0x04,
+	CLOCK_GPIO_PORT_F       = 0x05
+};
+
+/**
+ * @brief Acquires a reference to the clock of a peripheral instance.
+ *
+ * If this is the first reference, the clock is enabled in the corresponding RCGC register and
+ * the function waits until the corresponding bit is set in the PR register.
+ *
+ * No reference is acquired if the peripheral or instance is invalid, or if the clock
+ * already has 255 references.
+ *
+ * @param peripheral The type of peripheral (e.g. CLOCK_GPIO or CLOCK_TIMER).
+ *
+ * @param instance The instance of the peripheral (e.g. CLOCK_GPIO_PORT_A, or 0 for Timer 0).
+ *
+ * @return 1 if the reference was acquired, or 0 otherwise.
+ */
+uint8_t Clock_Manager_Acquire(uint8_t peripheral, uint8_t instance);
+
+/**
+ * @brief Releases a reference to the clock of a peripheral instance.
+ *
+ * If this was the last reference, the clock is gated in the corresponding RCGC register.
+ * Releasing a clock that has no reference has no effect.
+ *
+ * @param peripheral The type of peripheral (e.g. CLOCK_GPIO or CLOCK_TIMER).
+ *
+ * @param instance The instance of the peripheral (e.g. CLOCK_GPIO_PORT_A, or 0 for Timer 0).
+ *
+ * @return None
+ */
+void Clock_Manager_Release(uint8_t peripheral, uint8_t instance);
+
+/**
+ * @brief Returns the number of references to the clock of a peripheral instance.
+ *
+ * @param peripheral The type of peripheral (e.g. CLOCK_GPIO or CLOCK_TIMER).
+ *
+ * @param instance The instance of the peripheral (e.g. CLOCK_GPIO_PORT_A, or 0 for Timer 0).
+ *
+ * @return The number of references.
+ */
+uint8_t Clock_Manager_Get_Count(uint8_t peripheral, uint8_t instance);
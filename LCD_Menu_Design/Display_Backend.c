@@ -0,0 +1,356 @@
+/**
+ * @file Display_Backend.c
+ *
+ * @brief Source code for the Display_Backend interface.
+ *
+ * This file contains the function definitions for the Display_Backend interface.
+ * It allows the menu to render text to a grid of character cells without depending on a specific display.
+ * The following backends are provided:
+ *  - EduBase Board 16x2 Liquid Crystal Display (LCD)
+ *  - EduBase Board Seven-Segment Display (4 digits)
+ *  - Memory buffer (16x2) that can be read back by a host test or mirrored to another sink
+ *
+ * Each backend buffers the cells written with Put_Cells and transmits them when Flush is called.
+ * Display_Invalidate must be called after the display has been written to directly (e.g. with the EduBase_LCD
+ * functions), and Display_Refresh must be called from a periodic 1 ms task to keep multiplexed displays visible.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Display_Backend.h"
+#include "EduBase_LCD.h"
+#include "Seven_Segment_Display.h"
+#include "SPI_Flash.h"
+
+// Cells buffered by the EduBase LCD backend and the cells that have already been sent to the LCD
+static char lcd_backend_cells[EDUBASE_LCD_BACKEND_ROWS][EDUBASE_LCD_BACKEND_COLUMNS];
+static char lcd_backend_sent[EDUBASE_LCD_BACKEND_ROWS][EDUBASE_LCD_BACKEND_COLUMNS];
+static uint8_t lcd_backend_sent_valid = 0;
+
+// Segment patterns buffered by the seven-segment backend and the patterns that are being displayed (active low)
+static uint8_t seven_segment_backend_patterns[SEVEN_SEGMENT_BACKEND_COLUMNS] = {0xFF, 0xFF, 0xFF, 0xFF};
+static uint8_t seven_segment_backend_visible[SEVEN_SEGMENT_BACKEND_COLUMNS] = {0xFF, 0xFF, 0xFF, 0xFF};
+static uint8_t seven_segment_backend_refresh_col = 0;
+
+// Segment patterns of the letters A - Z (active low)
+// Letters that cannot be recognized on a seven-segment display are blank
+static const uint8_t seven_segment_letter_pattern[26] =
+{
+	0x88, // A
+	0x83, // b
+	0xC6, // C
+	0xA1, // d
+	0x86, // E
+	0x8E, // F
+	0xC2, // G
+	0x89, // H
+	0xCF, // I
+	0xE1, // J
+	0xFF, // K
+	0xC7, // L
+	0xFF, // M
+	0xAB, // n
+	0xC0, // O
+	0x8C, // P
+	0x98, // q
+	0xAF, // r
+	0x92, // S
+	0x87, // t
+	0xC1, // U
+	0xFF, // V
+	0xFF, // W
+	0xFF, // X
+	0x91, // y
+	0xFF  // Z
+};
+
+// Pending and visible frames of the memory backend
+static char memory_backend_pending[MEMORY_BACKEND_ROWS][MEMORY_BACKEND_COLUMNS];
+static char memory_backend_frame[MEMORY_BACKEND_ROWS][MEMORY_BACKEND_COLUMNS + 1];
+static uint32_t memory_backend_flush_count = 0;
+
+const Display_Backend EduBase_LCD_Display_Backend =
+{
+	EDUBASE_LCD_BACKEND_COLUMNS,
+	EDUBASE_LCD_BACKEND_ROWS,
+	DISPLAY_CAPABILITY_TEXT | DISPLAY_CAPABILITY_CUSTOM_CHARACTERS | DISPLAY_CAPABILITY_HARDWARE_SHIFT,
+	EduBase_LCD_Backend_Clear,
+	EduBase_LCD_Backend_Put_Cells,
+	EduBase_LCD_Backend_Flush,
+	EduBase_LCD_Backend_Invalidate,
+	0
+};
+
+const Display_Backend Seven_Segment_Display_Backend =
+{
+	SEVEN_SEGMENT_BACKEND_COLUMNS,
+	SEVEN_SEGMENT_BACKEND_ROWS,
+	DISPLAY_CAPABILITY_NEEDS_REFRESH,
+	Seven_Segment_Backend_Clear,
+	Seven_Segment_Backend_Put_Cells,
+	Seven_Segment_Backend_Flush,
+	0,
+	Seven_Segment_Backend_Refresh
+};
+
+const Display_Backend Memory_Display_Backend =
+{
+	MEMORY_BACKEND_COLUMNS,
+	MEMORY_BACKEND_ROWS,
+	DISPLAY_CAPABILITY_TEXT | DISPLAY_CAPABILITY_CUSTOM_CHARACTERS,
+	Memory_Backend_Clear,
+	Memory_Backend_Put_Cells,
+	Memory_Backend_Flush,
+	0,
+	0
+};
+
+void EduBase_LCD_Backend_Clear(void)
+{
+	memset(lcd_backend_cells, ' ', sizeof(lcd_backend_cells));
+}
+
+void EduBase_LCD_Backend_Put_Cells(uint8_t col, uint8_t row, const char* cells, uint8_t count)
+{
+	if (row >= EDUBASE_LCD_BACKEND_ROWS) return;
+
+	for (uint8_t i = 0; i < count && (col + i) < EDUBASE_LCD_BACKEND_COLUMNS; i++)
+	{
+		lcd_backend_cells[row][col + i] = cells[i];
+	}
+}
+
+void EduBase_LCD_Backend_Flush(void)
+{
+	// The contents of the LCD are unknown until the first flush, so every cell is sent once
+	if (!lcd_backend_sent_valid)
+	{
+		memset(lcd_backend_sent, 0xFF, sizeof(lcd_backend_sent));
+		lcd_backend_sent_valid = 1;
+	}
+
+	for (uint8_t row = 0; row < EDUBASE_LCD_BACKEND_ROWS; row++)
+	{
+		// Address of the next cell that the LCD will write to, or 0xFF if unknown
+		uint8_t next_col = 0xFF;
+
+		for (uint8_t col = 0; col < EDUBASE_LCD_BACKEND_COLUMNS; col++)
+		{
+			if (lcd_backend_cells[row][col] == lcd_backend_sent[row][col]) continue;
+
+			// Only set the DDRAM address at the start of a run of changed cells
+			// The address is incremented by the LCD after each data write
+			if (next_col != col)
+			{
+				EduBase_LCD_Send_Command(SET_DDRAM_ADDR | ((row * 0x40) + col));
+			}
+
+			EduBase_LCD_Send_Data(lcd_backend_cells[row][col]);
+			lcd_backend_sent[row][col] = lcd_backend_cells[row][col];
+			next_col = col + 1;
+		}
+	}
+}
+
+void EduBase_LCD_Backend_Invalidate(void)
+{
+	lcd_backend_sent_valid = 0;
+}
+
+void Seven_Segment_Backend_Clear(void)
+{
+	memset(seven_segment_backend_patterns, 0xFF, sizeof(seven_segment_backend_patterns));
+}
+
+void Seven_Segment_Backend_Put_Cells(uint8_t col, uint8_t row, const char* cells, uint8_t count)
+{
+	if (row >= SEVEN_SEGMENT_BACKEND_ROWS) return;
+
+	for (uint8_t i = 0; i < count && (col + i) < SEVEN_SEGMENT_BACKEND_COLUMNS; i++)
+	{
+		char cell = cells[i];
+		uint8_t pattern = 0xFF;
+
+		if (cell >= '0' && cell <= '9')
+		{
+			pattern = number_pattern[cell - '0'];
+		}
+		else if (cell >= 'A' && cell <= 'Z')
+		{
+			pattern = seven_segment_letter_pattern[cell - 'A'];
+		}
+		else if (cell >= 'a' && cell <= 'z')
+		{
+			pattern = seven_segment_letter_pattern[cell - 'a'];
+		}
+		else if (cell == '-')
+		{
+			// Only light up the middle segment (G)
+			pattern = 0xBF;
+		}
+
+		seven_segment_backend_patterns[col + i] = pattern;
+	}
+}
+
+void Seven_Segment_Backend_Flush(void)
+{
+	// The digits are written to the display by the periodic refresh
+	memcpy(seven_segment_backend_visible, seven_segment_backend_patterns, sizeof(seven_segment_backend_visible));
+}
+
+void Seven_Segment_Backend_Refresh(void)
+{
+	uint8_t col = seven_segment_backend_refresh_col;
+
+	// Do not interrupt a flash transaction on the SSI2 bus
+	// The current digit remains lit until the next refresh
+	if (SPI_Flash_Is_Busy()) return;
+
+	// Only one digit is lit at a time
+	// The rightmost digit is selected with 0x01 and the leftmost digit with 0x08
+	SSI2_Write(seven_segment_backend_visible[col]);
+	SSI2_Write(0x08 >> col);
+
+	seven_segment_backend_refresh_col = (col + 1) % SEVEN_SEGMENT_BACKEND_COLUMNS;
+}
+
+void Memory_Backend_Clear(void)
+{
+	memset(memory_backend_pending, ' ', sizeof(memory_backend_pending));
+}
+
+void Memory_Backend_Put_Cells(uint8_t col, uint8_t row, const char* cells, uint8_t count)
+{
+	if (row >= MEMORY_BACKEND_ROWS) return;
+
+	for (uint8_t i = 0; i < count && (col + i) < MEMORY_BACKEND_COLUMNS; i++)
+	{
+		memory_backend_pending[row][col + i] = cells[i];
+	}
+}
+
+void Memory_Backend_Flush(void)
+{
+	for (uint8_t row = 0; row < MEMORY_BACKEND_ROWS; row++)
+	{
+		memcpy(memory_backend_frame[row], memory_backend_pending[row], MEMORY_BACKEND_COLUMNS);
+		memory_backend_frame[row][MEMORY_BACKEND_COLUMNS] = '\0';
+	}
+
+	memory_backend_flush_count = memory_backend_flush_count + 1;
+}
+
+const char* Memory_Backend_Get_Row(uint8_t row)
+{
+	if (row >= MEMORY_BACKEND_ROWS) return "";
+
+	return memory_backend_frame[row];
+}
+
+uint32_t Memory_Backend_Get_Flush_Count(void)
+{
+	return memory_backend_flush_count;
+}
+
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_MULTIPLE
+
+static const Display_Backend* display_backends[DISPLAY_MAX_BACKENDS];
+static uint8_t display_backend_count = 0;
+
+void Display_Add_Backend(const Display_Backend* backend)
+{
+	if (display_backend_count < DISPLAY_MAX_BACKENDS)
+	{
+		display_backends[display_backend_count] = backend;
+		display_backend_count = display_backend_count + 1;
+	}
+}
+
+void Display_Clear(void)
+{
+	for (uint8_t i = 0; i < display_backend_count; i++)
+	{
+		display_backends[i]->Clear();
+	}
+}
+
+void Display_Put_Cells(uint8_t col, uint8_t row, const char* cells, uint8_t count)
+{
+	// Each backend clips the run to its own grid
+	for (uint8_t i = 0; i < display_backend_count; i++)
+	{
+		display_backends[i]->Put_Cells(col, row, cells, count);
+	}
+}
+
+void Display_Flush(void)
+{
+	for (uint8_t i = 0; i < display_backend_count; i++)
+	{
+		display_backends[i]->Flush();
+	}
+}
+
+void Display_Invalidate(void)
+{
+	// Only the backends that keep track of the cells sent to their display provide this function
+	for (uint8_t i = 0; i < display_backend_count; i++)
+	{
+		if (display_backends[i]->Invalidate != 0)
+		{
+			display_backends[i]->Invalidate();
+		}
+	}
+}
+
+void Display_Refresh(void)
+{
+	for (uint8_t i = 0; i < display_backend_count; i++)
+	{
+		if (display_backends[i]->Refresh != 0)
+		{
+			display_backends[i]->Refresh();
+		}
+	}
+}
+
+#endif
+
+void Display_Put_String(uint8_t col, uint8_t row, const char* string)
+{
+	Display_Put_Cells(col, row, string, (uint8_t)strlen(string));
+}
+
+void Display_Put_Stream(const uint8_t* stream)
+{
+	uint8_t col = 0;
+	uint8_t row = 0;
+
+	while (*stream != LCD_STREAM_END)
+	{
+		if (*stream == LCD_STREAM_COMMAND)
+		{
+			if (stream[1] == CLEAR_DISPLAY)
+			{
+				Display_Clear();
+				col = 0;
+				row = 0;
+			}
+			else if (stream[1] & SET_DDRAM_ADDR)
+			{
+				// The second row of the LCD starts at DDRAM address 0x40
+				row = (stream[1] & 0x40) ? 1 : 0;
+				col = stream[1] & 0x3F;
+			}
+			stream = stream + 2;
+		}
+		else
+		{
+			uint8_t length = stream[1];
+			Display_Put_Cells(col, row, (const char*)&stream[2], length);
+			col = col + length;
+			stream = stream + 2 + length;
+		}
+	}
+}
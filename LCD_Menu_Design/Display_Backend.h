@@ -0,0 +1,351 @@
+/**
+ * @file Display_Backend.h
+ *
+ * @brief Header file for the Display_Backend interface.
+ *
+ * This file contains the function definitions for the Display_Backend interface.
+ * It allows the menu to render text to a grid of character cells without depending on a specific display.
+ * The following backends are provided:
+ *  - EduBase Board 16x2 Liquid Crystal Display (LCD)
+ *  - EduBase Board Seven-Segment Display (4 digits)
+ *  - Memory buffer (16x2) that can be read back by a host test or mirrored to another sink
+ *
+ * Each backend buffers the cells written with Put_Cells and transmits them when Flush is called.
+ * Display_Invalidate must be called after the display has been written to directly (e.g. with the EduBase_LCD
+ * functions), and Display_Refresh must be called from a periodic 1 ms task to keep multiplexed displays visible.
+ *
+ * The backend is selected at compile time with the DISPLAY_BACKEND macro. If a single backend is selected,
+ * the Display_* functions map directly to the functions of that backend and no function pointers are used.
+ * If DISPLAY_BACKEND is set to DISPLAY_BACKEND_MULTIPLE, the Display_* functions forward each call to
+ * every backend registered with Display_Add_Backend.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+#define DISPLAY_BACKEND_MULTIPLE                0
+#define DISPLAY_BACKEND_EDUBASE_LCD             1
+#define DISPLAY_BACKEND_SEVEN_SEGMENT           2
+#define DISPLAY_BACKEND_MEMORY                  3
+
+#ifndef DISPLAY_BACKEND
+#define DISPLAY_BACKEND                         DISPLAY_BACKEND_EDUBASE_LCD
+#endif
+
+#define DISPLAY_MAX_BACKENDS                    4
+
+// Capability flags reported by each backend
+#define DISPLAY_CAPABILITY_TEXT                 0x01
+#define DISPLAY_CAPABILITY_CUSTOM_CHARACTERS    0x02
+#define DISPLAY_CAPABILITY_HARDWARE_SHIFT       0x04
+#define DISPLAY_CAPABILITY_NEEDS_REFRESH        0x08
+
+#define EDUBASE_LCD_BACKEND_COLUMNS             16
+#define EDUBASE_LCD_BACKEND_ROWS                2
+
+#define SEVEN_SEGMENT_BACKEND_COLUMNS           4
+#define SEVEN_SEGMENT_BACKEND_ROWS              1
+
+#define MEMORY_BACKEND_COLUMNS                  16
+#define MEMORY_BACKEND_ROWS                     2
+
+typedef struct
+{
+	uint8_t columns;
+	uint8_t rows;
+	uint8_t capabilities;
+	void (*Clear)(void);
+	void (*Put_Cells)(uint8_t col, uint8_t row, const char* cells, uint8_t count);
+	void (*Flush)(void);
+	void (*Invalidate)(void);
+	void (*Refresh)(void);
+} Display_Backend;
+
+extern const Display_Backend EduBase_LCD_Display_Backend;
+extern const Display_Backend Seven_Segment_Display_Backend;
+extern const Display_Backend Memory_Display_Backend;
+
+/**
+ * @brief Clears the cells buffered by the EduBase LCD backend.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Backend_Clear(void);
+
+/**
+ * @brief Writes a run of cells into the buffer of the EduBase LCD backend.
+ *
+ * Cells that fall outside of the 16x2 grid are ignored.
+ *
+ * @param col The column index (0-15) of the first cell.
+ *
+ * @param row The row index (0 or 1) of the cells.
+ *
+ * @param cells The characters to be written.
+ *
+ * @param count The number of characters to be written.
+ *
+ * @return None
+ */
+void EduBase_LCD_Backend_Put_Cells(uint8_t col, uint8_t row, const char* cells, uint8_t count);
+
+/**
+ * @brief Transmits the cells that have changed since the last flush to the LCD.
+ *
+ * This function compares the buffered cells with the cells that have already been sent
+ * and only transmits runs of changed cells. A Set DDRAM Address command is sent at the start of each run.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Backend_Flush(void);
+
+/**
+ * @brief Forgets the cells that have been sent to the LCD so that the next flush transmits every cell.
+ *
+ * This function must be called after the LCD has been written to without the backend
+ * (e.g. with EduBase_LCD_Send_Stream or EduBase_LCD_Clear_Display).
+ *
+ * @param None
+ *
+ * @return None
+ */
+void EduBase_LCD_Backend_Invalidate(void);
+
+/**
+ * @brief Clears the cells buffered by the seven-segment backend.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Seven_Segment_Backend_Clear(void);
+
+/**
+ * @brief Writes a run of cells into the buffer of the seven-segment backend.
+ *
+ * The characters '0' - '9', '-' and ' ' can be displayed. Letters are displayed in the same form
+ * regardless of their case, using the upper case (A, C, E, F, G, H, I, J, L, O, P, S, U) or lower case
+ * (b, d, n, q, r, t, y) shape that can be shown with seven segments. The letters K, M, V, W, X and Z
+ * and any other character are displayed as a blank digit.
+ *
+ * @param col The digit index (0-3) of the first cell, where 0 is the leftmost digit.
+ *
+ * @param row The row index. Only row 0 is available.
+ *
+ * @param cells The characters to be written.
+ *
+ * @param count The number of characters to be written.
+ *
+ * @return None
+ */
+void Seven_Segment_Backend_Put_Cells(uint8_t col, uint8_t row, const char* cells, uint8_t count);
+
+/**
+ * @brief Makes the buffered digits visible on the seven-segment display.
+ *
+ * The digits are written to the display by Seven_Segment_Backend_Refresh.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Seven_Segment_Backend_Flush(void);
+
+/**
+ * @brief Writes the next visible digit to the seven-segment display.
+ *
+ * The seven-segment display is multiplexed and only shows one digit at a time, so this function must be called
+ * from a periodic task (DISPLAY_CAPABILITY_NEEDS_REFRESH). Each digit is refreshed every 4 ms with a 1 ms task.
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note SSI2 is also used by the SPI_Flash driver. The refresh is skipped while an SPI_Flash transaction
+ * is in progress (SPI_Flash_Is_Busy).
+ */
+void Seven_Segment_Backend_Refresh(void);
+
+/**
+ * @brief Clears the cells of the memory backend.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Memory_Backend_Clear(void);
+
+/**
+ * @brief Writes a run of cells into the memory backend.
+ *
+ * @param col The column index (0-15) of the first cell.
+ *
+ * @param row The row index (0 or 1) of the cells.
+ *
+ * @param cells The characters to be written.
+ *
+ * @param count The number of characters to be written.
+ *
+ * @return None
+ */
+void Memory_Backend_Put_Cells(uint8_t col, uint8_t row, const char* cells, uint8_t count);
+
+/**
+ * @brief Copies the pending cells of the memory backend to its visible frame and increments the flush counter.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Memory_Backend_Flush(void);
+
+/**
+ * @brief Returns a row of the visible frame of the memory backend.
+ *
+ * @param row The row index (0 or 1).
+ *
+ * @return A pointer to a null-terminated string containing the 16 cells of the row.
+ */
+const char* Memory_Backend_Get_Row(uint8_t row);
+
+/**
+ * @brief Returns the number of times the memory backend has been flushed.
+ *
+ * @param None
+ *
+ * @return The number of flushes since startup.
+ */
+uint32_t Memory_Backend_Get_Flush_Count(void);
+
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_EDUBASE_LCD
+
+#define DISPLAY_COLUMNS         EDUBASE_LCD_BACKEND_COLUMNS
+#define DISPLAY_ROWS            EDUBASE_LCD_BACKEND_ROWS
+#define Display_Clear           EduBase_LCD_Backend_Clear
+#define Display_Put_Cells       EduBase_LCD_Backend_Put_Cells
+#define Display_Flush           EduBase_LCD_Backend_Flush
+#define Display_Invalidate      EduBase_LCD_Backend_Invalidate
+#define Display_Refresh()
+
+#elif DISPLAY_BACKEND == DISPLAY_BACKEND_SEVEN_SEGMENT
+
+#define DISPLAY_COLUMNS         SEVEN_SEGMENT_BACKEND_COLUMNS
+#define DISPLAY_ROWS            SEVEN_SEGMENT_BACKEND_ROWS
+#define Display_Clear           Seven_Segment_Backend_Clear
+#define Display_Put_Cells       Seven_Segment_Backend_Put_Cells
+#define Display_Flush           Seven_Segment_Backend_Flush
+#define Display_Invalidate()
+#define Display_Refresh         Seven_Segment_Backend_Refresh
+
+#elif DISPLAY_BACKEND == DISPLAY_BACKEND_MEMORY
+
+#define DISPLAY_COLUMNS         MEMORY_BACKEND_COLUMNS
+#define DISPLAY_ROWS            MEMORY_BACKEND_ROWS
+#define Display_Clear           Memory_Backend_Clear
+#define Display_Put_Cells       Memory_Backend_Put_Cells
+#define Display_Flush           Memory_Backend_Flush
+#define Display_Invalidate()
+#define Display_Refresh()
+
+#else
+
+#define DISPLAY_COLUMNS         EDUBASE_LCD_BACKEND_COLUMNS
+#define DISPLAY_ROWS            EDUBASE_LCD_BACKEND_ROWS
+
+/**
+ * @brief Registers a backend that will receive every Display_* call.
+ *
+ * Up to DISPLAY_MAX_BACKENDS backends can be registered. Only available when
+ * DISPLAY_BACKEND is set to DISPLAY_BACKEND_MULTIPLE.
+ *
+ * @param backend A pointer to the backend to be registered.
+ *
+ * @return None
+ */
+void Display_Add_Backend(const Display_Backend* backend);
+
+/**
+ * @brief Clears the cells of every registered backend.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Display_Clear(void);
+
+/**
+ * @brief Writes a run of cells to every registered backend.
+ *
+ * The run is clipped to the grid of each backend.
+ *
+ * @param col The column index of the first cell.
+ *
+ * @param row The row index of the cells.
+ *
+ * @param cells The characters to be written.
+ *
+ * @param count The number of characters to be written.
+ *
+ * @return None
+ */
+void Display_Put_Cells(uint8_t col, uint8_t row, const char* cells, uint8_t count);
+
+/**
+ * @brief Flushes every registered backend.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Display_Flush(void);
+
+/**
+ * @brief Invalidates the cells that every registered backend has sent to its display.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Display_Invalidate(void);
+
+/**
+ * @brief Refreshes every registered backend that needs to be refreshed periodically.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Display_Refresh(void);
+
+#endif
+
+/**
+ * @brief Writes a null-terminated string to the display starting at the specified cell.
+ *
+ * @param col The column index of the first cell.
+ *
+ * @param row The row index of the cells.
+ *
+ * @param string The null-terminated string to be written.
+ *
+ * @return None
+ */
+void Display_Put_String(uint8_t col, uint8_t row, const char* string);
+
+/**
+ * @brief Renders a precompiled LCD screen stream into the cells of the display.
+ *
+ * This function decodes a stream generated from LCD_Screens.def. A Clear Display command clears the cells,
+ * a Set DDRAM Address command moves to the corresponding row and column, and each run of data bytes is
+ * written with Display_Put_Cells. The cells are not flushed.
+ *
+ * @param stream A pointer to the first record of the stream.
+ *
+ * @return None
+ */
+void Display_Put_Stream(const uint8_t* stream);
@@ -15,60 +15,71 @@
  */
 
 #include "EduBase_Button_Interrupt.h"
+#include "Clock_Manager.h"
+#include "Interrupt_Guard.h"
 
 // Declare a pointer to the user-defined task
 void (*EduBase_Button_Task)(uint8_t edubase_button_status);
 
+// Executes the user-defined task while Port D is polled after an interrupt storm
+static void EduBase_Button_Poll_Task(void)
+{
+	(*EduBase_Button_Task)(Get_EduBase_Button_Status());
+}
+
 void EduBase_Button_Interrupt_Init(void(*task)(uint8_t))
 {
 	// Store the user-defined task function for use during interrupt handling
 	EduBase_Button_Task = task;
 	
-	// Enable the clock to Port D by setting the R3 bit (Bit 3) in the RCGCGPIO register
-	SYSCTL->RCGCGPIO |= 0x08;
+	// Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
+	// Enable the clock to Port D and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_D);
 	
 	// Configure the PD3 and PD2 pins as input by clearing Bits 3 to 2 in the DIR register
-	GPIOD->DIR &= ~0x0C;
+	GPIO_PORT_D->DIR &= ~0x0C;
 	
 	// Configure the PD3 and PD2 pins to function as
 	// GPIO pins by clearing Bits 3 to 2 in the AFSEL register
-	GPIOD->AFSEL &= ~0x0C;
+	GPIO_PORT_D->AFSEL &= ~0x0C;
 	
 	// Enable the digital functionality for the PD3 and PD2 pins
 	// by setting Bits 3 to 2 in the DEN register
-	GPIOD->DEN |= 0x0C;
+	GPIO_PORT_D->DEN |= 0x0C;
 	
 	// Enable the weak pull-down resistor for the PD3 and PD2 pins
 	// by setting Bits 3 to 2 in the PDR register
-	GPIOD->PDR |= 0x0C;
+	GPIO_PORT_D->PDR |= 0x0C;
 	
 	// Configure the PD3 and PD2 pins to detect edges
 	// by clearing Bits 3 to 2 in the IS register
-	GPIOD->IS &= ~0x0C;
+	GPIO_PORT_D->IS &= ~0x0C;
 	
 	// Allow the GPIOIEV register to handle interrupt generation
 	// and determine which edge to check for the PD3 and PD2 pins 
 	// by clearing Bits 3 to 2 in the IBE register
-	GPIOD->IBE &= ~0x0C;
+	GPIO_PORT_D->IBE &= ~0x0C;
 	
 	// Configure the PD3 and PD2 pins to detect
 	// rising edges by setting Bits 3 to 2 in the IEV register
 	// Rising edges on the corresponding pins will trigger interrupts
-	GPIOD->IEV |= 0x0C;
+	GPIO_PORT_D->IEV |= 0x0C;
+	
+	// Limit the rate of the interrupts generated by the PD3 and PD2 pins
+	Interrupt_Guard_Init(INTERRUPT_GUARD_EDUBASE_BUTTON, GPIO_PORT_D, 0x0C, &EduBase_Button_Poll_Task);
 	
 	// Clear any existing interrupt flags on the PD3 and PD2 pins
 	// by setting Bits 3 to 2 in the ICR register
-	GPIOD->ICR |= 0x0C;
+	GPIO_PORT_D->ICR |= 0x0C;
 	
 	// Allow the interrupts that are generated by the PD3 and PD2 pins to be 
 	// sent to the interrupt controller by setting Bits 3 to 2 in the IM register
-	GPIOD->IM |= 0x0C;
-	
-	// Clear the INTD field (Bits 31 to 29) of the IPR[0] register (PRI0)
-	NVIC->IPR[0] &= ~0xE0000000;
+	GPIO_PORT_D->IM |= 0x0C;
 	
 	// Set the priority level of the interrupts to 3. Port D has an Interrupt Request (IRQ) number of 3
-	NVIC->IPR[0] |= (3 << 29);
+	NVIC_SetPriority(GPIOD_IRQn, 3);
 	
 	// Enable IRQ 3 for GPIO Port D by setting Bit 3 in the ISER[0] register
 	NVIC->ISER[0] |= (1 << 3);
@@ -78,14 +89,18 @@ void GPIOD_Handler(void)
 {
 	// Check if an interrupt has been triggered by any of
 	// the following pins: PD3 and PD2
-	if (GPIOD->MIS & 0x0C)
+	if (GPIO_PORT_D->MIS & 0x0C)
 	{
 		// Execute the user-defined function and pass the 
 		// status of the EduBase board push buttons
-		(*EduBase_Button_Task)(Get_EduBase_Button_Status());
+		// unless the pins have been masked because they generate an interrupt storm
+		if (Interrupt_Guard_Count(INTERRUPT_GUARD_EDUBASE_BUTTON))
+		{
+			(*EduBase_Button_Task)(Get_EduBase_Button_Status());
+		}
 		
 		// Acknowledge the interrupt from any of the following pins
 		// and clear it: PD3 and PD2
-		GPIOD->ICR |= 0x0C;
+		GPIO_PORT_D->ICR |= 0x0C;
 	}
 }
@@ -11,6 +11,10 @@
  * It configures the pins to trigger interrupts on rising edges. The EduBase Board 
  * push buttons operate in an active high configuration.
  *
+ * If the buttons generate more interrupts than the storm threshold of the Interrupt_Guard driver,
+ * the pins are masked and polled until they are calm.
+ * Interrupt_Guard_Tick must be called every 1 ms to poll and unmask the pins.
+ *
  * @author Aaron Nanas
  */
 
@@ -20,108 +20,110 @@
  */
  
 #include "EduBase_LCD.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
 
 static uint8_t display_control = 0x00;
 static uint8_t display_mode = 0x00;
 
 void EduBase_LCD_Ports_Init(void)
 {
-	//Enable the clock to Port A by setting the
-	//R0 bit (Bit 0) in the RCGCGPIO register
-	SYSCTL->RCGCGPIO |= 0x01;
+	//Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
+	//Enable the clock to Port A and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_A);
 	
 	//Configure the PA5, PA4, PA3, and PA2 pins as output
 	//by setting Bits 5 to 2 in the DIR register
-	GPIOA->DIR |= 0x3C;
+	GPIO_PORT_A->DIR |= 0x3C;
 	
 	//Configure the PA5, PA4, PA3, and PA2 pins to function as
 	//GPIO pins by clearing Bits 5 to 2 in the AFSEL register
-	GPIOA->AFSEL &= ~0x3C;
+	GPIO_PORT_A->AFSEL &= ~0x3C;
 	
 	//Enable the digital functionality for the PA5, PA4, PA3, and PA2 pins
 	//by setting Bits 5 to 2 in the DEN register
-	GPIOA->DEN |= 0x3C;
+	GPIO_PORT_A->DEN |= 0x3C;
 	
 	//Initialize the output of the PA5, PA4, PA3, and PA2 pins to zero
 	//by clearing Bits 5 to 2 in the DATA register
-	GPIOA->DATA &= ~0x3C;
+	GPIO_PORT_A->DATA &= ~0x3C;
 	
-	//Enable the clock to Port C by setting the
-	//R2 bit(Bit 2) in the RCGCGPIO register
-	SYSCTL->RCGCGPIO |= 0x04;
+	//Enable the clock to Port C and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_C);
 	
 	//Configure the PC6 pin as output by setting Bit 6 in the DIR register
-	GPIOC->DIR |= 0x40;
+	GPIO_PORT_C->DIR |= 0x40;
 	
 	//Configure the PC6 pin to function as a GPIO pin
 	//by clearing Bit 6 in the AFSEL register
-	GPIOC->AFSEL &= ~0x40;
+	GPIO_PORT_C->AFSEL &= ~0x40;
 	
 	//Enable the digital functionality for the PA6 pin
 	//by setting Bit 6 in the DEN register
-	GPIOC->DEN |= 0x40;
+	GPIO_PORT_C->DEN |= 0x40;
 	
 	//Initialize the output of the PC6 pin
 	//by clearing Bits 6 in the DATA register
-	GPIOC->DATA &= ~0x40;
+	GPIO_PORT_C->DATA &= ~0x40;
 	
-	//Enable the clock to Port E by setting the
-	//R4 bit (Bit 4) in the RCGCGPIO register
-	SYSCTL->RCGCGPIO |= 0x10;
+	//Enable the clock to Port E and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_E);
 	
 	//Configure the PE0 pin as output by setting Bit 0 in the DIR register
-	GPIOE->DIR |= 0x01;
+	GPIO_PORT_E->DIR |= 0x01;
 	
 	//Configure the PE0 pin to function as a GPIO pin\
 	//by clearing Bit 0 in the AFSEL register
-	GPIOE->AFSEL &= ~0x01;
+	GPIO_PORT_E->AFSEL &= ~0x01;
 	
 	//Enable the digital functionality for the PE0 pin
 	//by setting Bit 0 in the DEN register
-	GPIOE->DEN |= 0x01;
+	GPIO_PORT_E->DEN |= 0x01;
 	
 	//Initialize the output of the PE0 pin to zero
 	//by clearing Bit 0 in the DATA register
-	GPIOE->DATA &= ~0x01;
+	GPIO_PORT_E->DATA &= ~0x01;
 }
 
 void EduBase_LCD_Pulse_Enable(void)
 {
  //Ensure that the output of the PC6 pin is zero before sending a short pulse
-	GPIOC->DATA &= ~0x40;
+	GPIO_PORT_C->DATA &= ~0x40;
 	SysTick_Delay1us(1);
 	
 	//Output a short pulse on the PC6 pin by setting Bit 6
 	//in the DATA register high and clearing it after 1us.
 	//The minimum time for the enable pulse width must be at least greater than 420 ns
 	//during a read/write operation 
-	GPIOC->DATA |= 0x40;
+	GPIO_PORT_C->DATA |= 0x40;
 	SysTick_Delay1us(1);
-	GPIOC->DATA &= ~0x40;
+	GPIO_PORT_C->DATA &= ~0x40;
 }
 
 void EduBase_LCD_Write_4_Bits(uint8_t data, uint8_t control_flag)
 {
  //Set the upper nibble of the data on the data pins (PA2 - PA5)
-	GPIOA->DATA |= (data & 0xF0) >> 0x2;
+	GPIO_PORT_A->DATA |= (data & 0xF0) >> 0x2;
 	
 	//Set or clear the register select (RS) pin based on the control flag
 	//0 for command and 1 for data
 	if (control_flag & 0x01)
 	{
-		GPIOE->DATA |= 0x01;
+		GPIO_PORT_E->DATA |= 0x01;
 	}
 	
 	else
 	{
-		GPIOE->DATA &= ~0x01;
+		GPIO_PORT_E->DATA &= ~0x01;
 	}
 	
 	//Output a short pulse on the PC6 pin to enable the LCD
 	EduBase_LCD_Pulse_Enable();
 	
 	//Clear the LCD data lines (PA2 - PA5) and provide a 1 ms delay
-	GPIOA->DATA &= ~0x3C;
+	GPIO_PORT_A->DATA &= ~0x3C;
 	SysTick_Delay1us(1000);
 }
 
@@ -212,7 +214,7 @@ void EduBase_LCD_Set_Cursor(uint8_t col, uint8_t row)
 	{
 		if(row == 0)
 		{
-			EduBase_LCD_Send_Command(SET_CGRAM_ADDR | col);
+			EduBase_LCD_Send_Command(SET_DDRAM_ADDR | col);
 		}
 		
 		else if (row == 1)
@@ -320,4 +322,26 @@ void EduBase_LCD_Display_Heart(void)
 	
 	EduBase_LCD_Set_Cursor(0, 0);
 	EduBase_LCD_Send_Data(HEART_SHAPE_LOCATION);
-}
\ No newline at end of file
+}
+
+void EduBase_LCD_Send_Stream(const uint8_t* stream)
+{
+	while (*stream != LCD_STREAM_END)
+	{
+		if (*stream == LCD_STREAM_COMMAND)
+		{
+			EduBase_LCD_Send_Command(stream[1]);
+			stream = stream + 2;
+		}
+		else
+		{
+			// Transmit a run of data bytes. The length of the run is stored after the record type
+			uint8_t length = stream[1];
+			for (uint8_t i = 0; i < length; i++)
+			{
+				EduBase_LCD_Send_Data(stream[2 + i]);
+			}
+			stream = stream + 2 + length;
+		}
+	}
+}
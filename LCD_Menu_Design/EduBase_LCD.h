@@ -147,6 +147,13 @@ enum Custom_Character_CGRAM_Locations
 	HEART_SHAPE_LOCATION		= 0x04
 };
 
+enum LCD_Stream_Records
+{
+	LCD_STREAM_END          = 0x00,
+	LCD_STREAM_COMMAND      = 0x01,
+	LCD_STREAM_DATA         = 0x02
+};
+
 /**
  * @brief Initializes the GPIO pins used by the 16x2 LCD on the EduBase board.
  *
@@ -433,4 +440,19 @@ void EduBase_LCD_Display_Double(double value);
  *
  * @return None
  */
-void EduBase_LCD_Display_Heart(void);
\ No newline at end of file
+void EduBase_LCD_Display_Heart(void);
+
+/**
+ * @brief Sends a precompiled command stream to the LCD.
+ *
+ * This function transmits a stream of records that has been compiled ahead of time
+ * (see LCD_Screens.def and Tools/generate_lcd_screens.py). Each record is one of the following:
+ *  - LCD_STREAM_COMMAND followed by the command byte
+ *  - LCD_STREAM_DATA followed by the number of data bytes and the data bytes
+ *  - LCD_STREAM_END, which terminates the stream
+ *
+ * @param stream A pointer to the first record of the stream.
+ *
+ * @return None
+ */
+void EduBase_LCD_Send_Stream(const uint8_t* stream);
@@ -0,0 +1,287 @@
+/**
+ * @file EduBase_LCD_DMA.c
+ *
+ * @brief Source code for the EduBase_LCD_DMA driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_DMA driver.
+ * It refreshes the EduBase Board 16x2 Liquid Crystal Display (LCD) without CPU involvement
+ * by streaming a pre-rendered frame to the LCD pins with the Micro Direct Memory Access (uDMA) controller.
+ *
+ * A frame is rendered into a task list where each task writes one value to one of the
+ * following masked GPIO DATA aliases:
+ *  - Data Pins [D4 - D7] (PA2 - PA5)
+ *	- LCD Enable      [E] (PC6)
+ *  - Register Select [RS] (PE0)
+ *
+ * Timer 1A triggers uDMA channel 20 in Peripheral Scatter-Gather mode so that one task is
+ * executed on every time-out. The CPU is only interrupted once the complete frame has been sent.
+ *
+ * The clocks to the uDMA controller and Timer 1 are only enabled while a frame is being transmitted.
+ *
+ * @note The LCD must be initialized with EduBase_LCD_Init before calling EduBase_LCD_DMA_Init.
+ * The blocking EduBase_LCD functions must not be called while a frame is being transmitted.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @note For more information regarding the uDMA controller, refer to Chapter 9 (Micro Direct Memory Access)
+ * of the TM4C123G Microcontroller Datasheet.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "EduBase_LCD_DMA.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
+
+// Timer 1A is assigned to uDMA channel 20 with the default encoding (0)
+#define LCD_DMA_CHANNEL             20
+
+// Each byte requires up to seven GPIO writes: register select, and for each nibble
+// the data pins, the rising edge and the falling edge of the enable pin
+// One additional write clears the data pins after the frame has been sent
+#define LCD_DMA_BYTES_PER_FRAME     (EDUBASE_LCD_DMA_ROWS * (EDUBASE_LCD_DMA_COLUMNS + 1))
+#define LCD_DMA_MAX_TASKS           ((LCD_DMA_BYTES_PER_FRAME * 7) + 1)
+
+// Channel control word for a task that copies one 32-bit word without incrementing
+// either address (DSTINC = SRCINC = 0x3, DSTSIZE = SRCSIZE = 0x2, ARBSIZE = 1, XFERSIZE = 1)
+#define LCD_DMA_WORD_COPY           ((0x3U << 30) | (0x2U << 28) | (0x3U << 26) | (0x2U << 24))
+
+// Transfer modes used in the XFERMODE field (Bits 2 to 0) of the DMACHCTL register
+#define LCD_DMA_MODE_BASIC          0x1
+#define LCD_DMA_MODE_PERIPHERAL_SG  0x6
+#define LCD_DMA_MODE_ALTERNATE_SG   0x7
+
+// Address of the GPIODATA alias that only modifies the pins selected by mask
+// Address bits [9:2] of the GPIODATA register are used as the bit mask for the write
+#define LCD_DMA_GPIO_DATA(port, mask) ((volatile uint32_t*)((uint32_t)(port) + ((mask) << 2)))
+
+typedef struct
+{
+	volatile uint32_t* source_end;
+	volatile uint32_t* destination_end;
+	uint32_t control;
+	uint32_t unused;
+} DMA_Control_Structure;
+
+// The control table holds the primary (0 - 31) and alternate (32 - 63) control structures
+// and must be aligned on a 1024-byte boundary
+static DMA_Control_Structure dma_control_table[64] __attribute__((aligned(1024)));
+
+// List of tasks that are copied into the alternate control structure by the primary control structure
+static DMA_Control_Structure lcd_dma_task_list[LCD_DMA_MAX_TASKS];
+static uint32_t lcd_dma_task_count = 0;
+
+// Values written to the GPIO pins. They are kept in SRAM so that the uDMA controller
+// fetches them through the same bus as the task list
+static uint32_t nibble_values[16];
+static uint32_t enable_values[2] = {0x00, 0x40};
+static uint32_t register_select_values[2] = {0x00, 0x01};
+
+static volatile uint8_t lcd_dma_busy = 0;
+
+// Declare pointer to the user-defined task
+void (*EduBase_LCD_DMA_Task)(void);
+
+static void EduBase_LCD_DMA_Add_Task(volatile uint32_t* destination, uint32_t* value)
+{
+	DMA_Control_Structure* task = &lcd_dma_task_list[lcd_dma_task_count];
+
+	// Each task is executed by the alternate control structure, which returns to the
+	// primary control structure afterwards to fetch the next task
+	task->source_end = value;
+	task->destination_end = destination;
+	task->control = LCD_DMA_WORD_COPY | LCD_DMA_MODE_ALTERNATE_SG;
+	task->unused = 0;
+
+	lcd_dma_task_count = lcd_dma_task_count + 1;
+}
+
+static void EduBase_LCD_DMA_Add_Byte(uint8_t data, uint8_t control_flag, uint8_t* last_control_flag)
+{
+	// Only write the register select (RS) pin when its value changes
+	if (control_flag != *last_control_flag)
+	{
+		EduBase_LCD_DMA_Add_Task(LCD_DMA_GPIO_DATA(GPIO_PORT_E, 0x01), &register_select_values[control_flag]);
+		*last_control_flag = control_flag;
+	}
+
+	// Transmit the upper nibble followed by the lower nibble of the byte on the data pins (PA2 - PA5)
+	// and latch each nibble with a pulse on the enable pin (PC6)
+	EduBase_LCD_DMA_Add_Task(LCD_DMA_GPIO_DATA(GPIO_PORT_A, 0x3C), &nibble_values[(data >> 4) & 0x0F]);
+	EduBase_LCD_DMA_Add_Task(LCD_DMA_GPIO_DATA(GPIO_PORT_C, 0x40), &enable_values[1]);
+	EduBase_LCD_DMA_Add_Task(LCD_DMA_GPIO_DATA(GPIO_PORT_C, 0x40), &enable_values[0]);
+
+	EduBase_LCD_DMA_Add_Task(LCD_DMA_GPIO_DATA(GPIO_PORT_A, 0x3C), &nibble_values[data & 0x0F]);
+	EduBase_LCD_DMA_Add_Task(LCD_DMA_GPIO_DATA(GPIO_PORT_C, 0x40), &enable_values[1]);
+	EduBase_LCD_DMA_Add_Task(LCD_DMA_GPIO_DATA(GPIO_PORT_C, 0x40), &enable_values[0]);
+}
+
+void EduBase_LCD_DMA_Init(void(*task)(void))
+{
+	// Store the user-defined task function for use during interrupt handling
+	EduBase_LCD_DMA_Task = task;
+
+	// Pre-compute the value of the data pins (PA2 - PA5) for each nibble
+	for (int i = 0; i < 16; i++)
+	{
+		nibble_values[i] = (uint32_t)(i << 2);
+	}
+
+	// Enable the clock to the uDMA controller and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_DMA, 0);
+
+	// Enable the uDMA controller by setting the MASTEN bit (Bit 0) in the DMACFG register
+	UDMA->CFG = 0x01;
+
+	// Set the base address of the channel control table in the DMACTLBASE register
+	UDMA->CTLBASE = (uint32_t)dma_control_table;
+
+	// Assign Timer 1A to channel 20 by clearing the CH20SEL field (Bits 19 to 16) in the DMACHMAP2 register
+	UDMA->CHMAP2 &= ~0x000F0000;
+
+	// Use the primary control structure, allow single requests and
+	// allow the peripheral to make requests for channel 20
+	UDMA->ALTCLR = (1 << LCD_DMA_CHANNEL);
+	UDMA->USEBURSTCLR = (1 << LCD_DMA_CHANNEL);
+	UDMA->REQMASKCLR = (1 << LCD_DMA_CHANNEL);
+
+	// Enable the clock for Timer 1A and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_TIMER, 1);
+
+	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
+	// to disable Timer 1A
+	TIMER1->CTL &= ~0x01;
+
+	// Select the 16-bit timer configuration by writing 0x4 to the GPTMCFG register
+	TIMER1->CFG = 0x04;
+
+	// Select the Periodic Timer Mode by writing 0x2 to the TAMR field (Bits 1 to 0)
+	TIMER1->TAMR = 0x02;
+
+	// Set the prescale value to 50
+	// New timer clock frequency = (50 MHz / 50) = 1 MHz
+	TIMER1->TAPR = 50;
+
+	// Set the interval between two consecutive GPIO writes
+	TIMER1->TAILR = (EDUBASE_LCD_DMA_TICK_US - 1);
+
+	// Clear the time-out (Bit 0) and DMA done (Bit 5) interrupt flags
+	TIMER1->ICR = 0x21;
+
+	// Only enable the DMA done interrupt by setting the DMAAIM bit (Bit 5) in the GPTMIMR register
+	// The time-out events are used as uDMA requests and do not interrupt the CPU
+	TIMER1->IMR = 0x20;
+
+	// Set the priority level to 2 for the Timer 1A interrupt (IRQ 21)
+	NVIC_SetPriority(TIMER1A_IRQn, 2);
+
+	// Enable IRQ 21 for Timer 1A by setting Bit 21 in the ISER[0] register
+	NVIC->ISER[0] |= (1 << 21);
+
+	// Gate the clocks until the first frame is started
+	// The configuration of the uDMA controller and Timer 1A is retained
+	Clock_Manager_Release(CLOCK_TIMER, 1);
+	Clock_Manager_Release(CLOCK_DMA, 0);
+}
+
+uint8_t EduBase_LCD_DMA_Render_Frame(const char* row_0, const char* row_1)
+{
+	const char* rows[EDUBASE_LCD_DMA_ROWS] = {row_0, row_1};
+	const uint8_t row_addresses[EDUBASE_LCD_DMA_ROWS] = {0x80, 0xC0};
+
+	// The task list cannot be modified while it is being transmitted
+	if (lcd_dma_busy) return 0;
+
+	lcd_dma_task_count = 0;
+
+	// Force the register select pin to be written by the first byte
+	uint8_t last_control_flag = 0xFF;
+
+	for (int row = 0; row < EDUBASE_LCD_DMA_ROWS; row++)
+	{
+		// Set the DDRAM address to the first column of the row
+		EduBase_LCD_DMA_Add_Byte(row_addresses[row], 0x00, &last_control_flag);
+
+		// Write the characters of the row and pad the remaining columns with spaces
+		const char* string = rows[row];
+		for (int col = 0; col < EDUBASE_LCD_DMA_COLUMNS; col++)
+		{
+			uint8_t character = ' ';
+			if (string != 0 && *string != '\0')
+			{
+				character = (uint8_t)*string;
+				string++;
+			}
+			EduBase_LCD_DMA_Add_Byte(character, 0x01, &last_control_flag);
+		}
+	}
+
+	// Clear the data pins (PA2 - PA5) as expected by the blocking EduBase_LCD functions
+	// The last task uses Basic mode so that the channel stops after it has been executed
+	EduBase_LCD_DMA_Add_Task(LCD_DMA_GPIO_DATA(GPIO_PORT_A, 0x3C), &nibble_values[0]);
+	lcd_dma_task_list[lcd_dma_task_count - 1].control = LCD_DMA_WORD_COPY | LCD_DMA_MODE_BASIC;
+
+	return 1;
+}
+
+uint8_t EduBase_LCD_DMA_Start_Frame(void)
+{
+	if (lcd_dma_busy || lcd_dma_task_count == 0) return 0;
+
+	DMA_Control_Structure* primary = &dma_control_table[LCD_DMA_CHANNEL];
+	DMA_Control_Structure* alternate = &dma_control_table[LCD_DMA_CHANNEL + 32];
+
+	// The primary control structure copies four words (one task) at a time
+	// from the task list into the alternate control structure
+	// (DSTINC = SRCINC = 0x2, DSTSIZE = SRCSIZE = 0x2, ARBSIZE = 4)
+	primary->source_end = &lcd_dma_task_list[lcd_dma_task_count - 1].unused;
+	primary->destination_end = &alternate->unused;
+	primary->control = (0x2U << 30) | (0x2U << 28) | (0x2U << 26) | (0x2U << 24) | (0x2U << 14)
+		| (((lcd_dma_task_count * 4) - 1) << 4) | LCD_DMA_MODE_PERIPHERAL_SG;
+
+	lcd_dma_busy = 1;
+
+	// Enable the clocks to the uDMA controller and Timer 1 for the duration of the frame
+	Clock_Manager_Acquire(CLOCK_DMA, 0);
+	Clock_Manager_Acquire(CLOCK_TIMER, 1);
+
+	// Select the primary control structure and enable channel 20
+	UDMA->ALTCLR = (1 << LCD_DMA_CHANNEL);
+	UDMA->ENASET = (1 << LCD_DMA_CHANNEL);
+
+	// Reload the counter and enable Timer 1A to start pacing the GPIO writes
+	TIMER1->TAV = (EDUBASE_LCD_DMA_TICK_US - 1);
+	TIMER1->CTL |= 0x01;
+
+	return 1;
+}
+
+uint8_t EduBase_LCD_DMA_Is_Busy(void)
+{
+	return lcd_dma_busy;
+}
+
+void TIMER1A_Handler(void)
+{
+	// Read the Timer 1A DMA done interrupt flag
+	if (TIMER1->MIS & 0x20)
+	{
+		// Stop pacing the GPIO writes
+		TIMER1->CTL &= ~0x01;
+
+		// Acknowledge the DMA done and time-out interrupts and clear them
+		TIMER1->ICR = 0x21;
+
+		// Gate the clocks until the next frame is started
+		Clock_Manager_Release(CLOCK_TIMER, 1);
+		Clock_Manager_Release(CLOCK_DMA, 0);
+
+		lcd_dma_busy = 0;
+
+		// Execute the user-defined function
+		if (EduBase_LCD_DMA_Task != 0)
+		{
+			(*EduBase_LCD_DMA_Task)();
+		}
+	}
+}
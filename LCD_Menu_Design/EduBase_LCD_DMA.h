@@ -0,0 +1,105 @@
+/**
+ * @file EduBase_LCD_DMA.h
+ *
+ * @brief Header file for the EduBase_LCD_DMA driver.
+ *
+ * This file contains the function definitions for the EduBase_LCD_DMA driver.
+ * It refreshes the EduBase Board 16x2 Liquid Crystal Display (LCD) without CPU involvement
+ * by streaming a pre-rendered frame to the LCD pins with the Micro Direct Memory Access (uDMA) controller.
+ *
+ * A frame is rendered into a task list where each task writes one value to one of the
+ * following masked GPIO DATA aliases:
+ *  - Data Pins [D4 - D7] (PA2 - PA5)
+ *	- LCD Enable      [E] (PC6)
+ *  - Register Select [RS] (PE0)
+ *
+ * Timer 1A triggers uDMA channel 20 in Peripheral Scatter-Gather mode so that one task is
+ * executed on every time-out. The CPU is only interrupted once the complete frame has been sent.
+ *
+ * @note The LCD must be initialized with EduBase_LCD_Init before calling EduBase_LCD_DMA_Init.
+ * The blocking EduBase_LCD functions must not be called while a frame is being transmitted.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @note For more information regarding the uDMA controller, refer to Chapter 9 (Micro Direct Memory Access)
+ * of the TM4C123G Microcontroller Datasheet.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+#define EDUBASE_LCD_DMA_COLUMNS     16
+#define EDUBASE_LCD_DMA_ROWS        2
+
+// Timer 1A time-out interval between two consecutive GPIO writes (in us)
+// Three writes separate the falling edges of the enable pin for consecutive bytes,
+// which satisfies the 37 us execution time of the HD44780 controller
+#define EDUBASE_LCD_DMA_TICK_US     15
+
+// Declare pointer to the user-defined task
+extern void (*EduBase_LCD_DMA_Task)(void);
+
+/**
+ * @brief Initializes the uDMA controller and Timer 1A used to stream frames to the LCD.
+ *
+ * This function enables the uDMA controller, assigns channel 20 to Timer 1A, and configures
+ * Timer 1A as a periodic timer with an interval of EDUBASE_LCD_DMA_TICK_US. The timer is left disabled
+ * until a frame is started. The provided task function will be executed from the Timer 1A interrupt
+ * once a frame has been completely transmitted. The priority level is set to 2.
+ *
+ * @param task A pointer to the user-defined function to be executed upon frame completion.
+ *             A null pointer can be passed if no notification is needed.
+ *
+ * @return None
+ */
+void EduBase_LCD_DMA_Init(void(*task)(void));
+
+/**
+ * @brief Renders a frame into the uDMA task list.
+ *
+ * This function converts the two rows of the frame into a list of GPIO writes. Each row is preceded
+ * by a Set DDRAM Address command. Each byte is split into its upper and lower nibbles, and each nibble
+ * is followed by a rising and falling edge on the enable pin. The register select pin is only written
+ * when its value changes. Rows shorter than 16 characters are padded with spaces.
+ *
+ * @param row_0 A null-terminated string that will be displayed on the top row.
+ *
+ * @param row_1 A null-terminated string that will be displayed on the bottom row.
+ *
+ * @return Returns 1 if the frame was rendered, or 0 if a frame is currently being transmitted.
+ */
+uint8_t EduBase_LCD_DMA_Render_Frame(const char* row_0, const char* row_1);
+
+/**
+ * @brief Starts the transmission of the most recently rendered frame.
+ *
+ * This function configures the primary control structure of channel 20 to copy the tasks
+ * into the alternate control structure, enables the channel, and starts Timer 1A.
+ *
+ * @param None
+ *
+ * @return Returns 1 if the transmission was started, or 0 if a frame is already being transmitted.
+ */
+uint8_t EduBase_LCD_DMA_Start_Frame(void);
+
+/**
+ * @brief Indicates whether a frame is currently being transmitted.
+ *
+ * @param None
+ *
+ * @return Returns 1 if a frame is being transmitted. Otherwise, it returns 0.
+ */
+uint8_t EduBase_LCD_DMA_Is_Busy(void);
+
+/**
+ * @brief The interrupt service routine (ISR) for Timer 1A.
+ *
+ * This function is the interrupt service routine (ISR) for the Timer 1A peripheral.
+ * It checks the Timer 1A DMA done interrupt flag, stops Timer 1A, and executes the user-defined task.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void TIMER1A_Handler(void);
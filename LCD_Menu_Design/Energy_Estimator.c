@@ -0,0 +1,168 @@
+/**
+ * @file Energy_Estimator.c
+ *
+ * @brief Source code for the Energy_Estimator module.
+ *
+ * This file contains the function definitions for the Energy_Estimator module.
+ * It estimates the current drawn by the board and the energy consumed over time from the state of the device:
+ *  - Power mode (run, sleep or deep-sleep) and core clock frequency
+ *  - Number of enabled peripheral clocks of each type (see Clock_Manager.h)
+ *  - Loads driven by the GPIO pins (EduBase LEDs lit, buzzer driven and stepper motor coils energized)
+ *
+ * The current is computed from a per-board coefficient table. The core and peripheral currents scale
+ * linearly with the clock frequency, and each load adds a fixed current. All currents are referred to the
+ * USB supply, since the 3.3 V rail of the LaunchPad is derived from it by a linear regulator.
+ *
+ * The state is updated whenever it changes, and Energy_Estimator_Advance accumulates the energy for
+ * the time spent in that state. The module does not access any register, so it can be compiled on the host
+ * to estimate the cost of a scripted session (see Tools/energy_session.c) or on the target.
+ *
+ * @note The coefficients of EduBase_TM4C123_Board are typical values taken from the TM4C123GH6PM datasheet
+ * and the component datasheets. They should be calibrated against measurements of a specific board.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Energy_Estimator.h"
+
+const Energy_Board EduBase_TM4C123_Board =
+{
+	// USB supply
+	5000,
+
+	// Run, sleep and deep-sleep currents with all peripheral clocks disabled
+	{3000, 1500, 900},
+	{380, 160, 20},
+
+	// GPIO, Timer, Wide Timer, SSI, PWM, uDMA, EEPROM and UART clocks
+	{2, 3, 4, 5, 6, 9, 5, 5},
+
+	// EduBase LED (with a 1 kOhm series resistor), buzzer and stepper motor coil (through the ULN2003 driver)
+	{1500, 12000, 120000}
+};
+
+static const Energy_Board* energy_board = &EduBase_TM4C123_Board;
+
+static uint8_t power_mode = ENERGY_MODE_RUN;
+static uint32_t core_clock_MHz = 50;
+static uint8_t peripheral_counts[ENERGY_PERIPHERAL_COUNT];
+static uint8_t load_counts[ENERGY_LOAD_COUNT];
+
+// Energy is accumulated in pJ (nW * ms), which overflows after approximately 10 months at 0.65 W (130 mA from the USB supply)
+// The energy below 1 pJ (uA * mV * us = fJ) is carried over to the next step to avoid rounding each step
+static uint64_t energy_pJ = 0;
+static uint32_t energy_remainder_fJ = 0;
+static uint64_t mode_time_us[ENERGY_MODE_COUNT];
+
+void Energy_Estimator_Init(const Energy_Board* board)
+{
+	energy_board = board;
+	power_mode = ENERGY_MODE_RUN;
+	core_clock_MHz = 50;
+	energy_pJ = 0;
+	energy_remainder_fJ = 0;
+
+	for (uint8_t i = 0; i < ENERGY_PERIPHERAL_COUNT; i++)
+	{
+		peripheral_counts[i] = 0;
+	}
+
+	for (uint8_t i = 0; i < ENERGY_LOAD_COUNT; i++)
+	{
+		load_counts[i] = 0;
+	}
+
+	for (uint8_t i = 0; i < ENERGY_MODE_COUNT; i++)
+	{
+		mode_time_us[i] = 0;
+	}
+}
+
+void Energy_Estimator_Set_Power_Mode(uint8_t mode)
+{
+	if (mode < ENERGY_MODE_COUNT)
+	{
+		power_mode = mode;
+	}
+}
+
+void Energy_Estimator_Set_Core_Clock(uint32_t clock_MHz)
+{
+	core_clock_MHz = clock_MHz;
+}
+
+void Energy_Estimator_Set_Peripheral_Count(uint8_t peripheral, uint8_t count)
+{
+	if (peripheral < ENERGY_PERIPHERAL_COUNT)
+	{
+		peripheral_counts[peripheral] = count;
+	}
+}
+
+void Energy_Estimator_Set_Load(uint8_t load, uint8_t count)
+{
+	if (load < ENERGY_LOAD_COUNT)
+	{
+		load_counts[load] = count;
+	}
+}
+
+uint32_t Energy_Estimator_Get_Current_uA(void)
+{
+	uint32_t current_uA = energy_board->mode_base_uA[power_mode]
+		+ (energy_board->mode_uA_per_MHz[power_mode] * core_clock_MHz);
+
+	for (uint8_t i = 0; i < ENERGY_PERIPHERAL_COUNT; i++)
+	{
+		current_uA = current_uA + (peripheral_counts[i] * energy_board->peripheral_uA_per_MHz[i] * core_clock_MHz);
+	}
+
+	for (uint8_t i = 0; i < ENERGY_LOAD_COUNT; i++)
+	{
+		current_uA = current_uA + (load_counts[i] * energy_board->load_uA[i]);
+	}
+
+	return current_uA;
+}
+
+void Energy_Estimator_Advance(uint32_t time_us)
+{
+	uint64_t power_nW = (uint64_t)Energy_Estimator_Get_Current_uA() * energy_board->supply_voltage_mV;
+
+	// Split the time into whole milliseconds and the remaining microseconds
+	// so that the products cannot overflow for any time_us
+	uint64_t remainder_fJ = (power_nW * (time_us % 1000)) + energy_remainder_fJ;
+
+	energy_pJ = energy_pJ + (power_nW * (time_us / 1000)) + (remainder_fJ / 1000);
+	energy_remainder_fJ = (uint32_t)(remainder_fJ % 1000);
+	mode_time_us[power_mode] = mode_time_us[power_mode] + time_us;
+}
+
+uint64_t Energy_Estimator_Get_Energy_uJ(void)
+{
+	return energy_pJ / 1000000ULL;
+}
+
+uint64_t Energy_Estimator_Get_Mode_Time_us(uint8_t mode)
+{
+	if (mode >= ENERGY_MODE_COUNT) return 0;
+
+	return mode_time_us[mode];
+}
+
+uint32_t Energy_Estimator_Get_Average_Current_uA(void)
+{
+	uint64_t total_time_us = 0;
+
+	for (uint8_t i = 0; i < ENERGY_MODE_COUNT; i++)
+	{
+		total_time_us = total_time_us + mode_time_us[i];
+	}
+
+	if (total_time_us == 0) return 0;
+
+	// Average power (pJ / us = uW, converted to nW) divided by the supply voltage (mV)
+	uint64_t power_nW = ((energy_pJ / total_time_us) * 1000) + (((energy_pJ % total_time_us) * 1000) / total_time_us);
+
+	return (uint32_t)(power_nW / energy_board->supply_voltage_mV);
+}
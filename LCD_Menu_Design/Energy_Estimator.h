@@ -0,0 +1,175 @@
+/**
+ * @file Energy_Estimator.h
+ *
+ * @brief Header file for the Energy_Estimator module.
+ *
+ * This file contains the function definitions for the Energy_Estimator module.
+ * It estimates the current drawn by the board and the energy consumed over time from the state of the device:
+ *  - Power mode (run, sleep or deep-sleep) and core clock frequency
+ *  - Number of enabled peripheral clocks of each type (see Clock_Manager.h)
+ *  - Loads driven by the GPIO pins (EduBase LEDs lit, buzzer driven and stepper motor coils energized)
+ *
+ * The current is computed from a per-board coefficient table. The core and peripheral currents scale
+ * linearly with the clock frequency, and each load adds a fixed current. All currents are referred to the
+ * USB supply, since the 3.3 V rail of the LaunchPad is derived from it by a linear regulator.
+ *
+ * The state is updated whenever it changes, and Energy_Estimator_Advance accumulates the energy for
+ * the time spent in that state. The module does not access any register, so it can be compiled on the host
+ * to estimate the cost of a scripted session (see Tools/energy_session.c) or on the target.
+ *
+ * @note The coefficients of EduBase_TM4C123_Board are typical values taken from the TM4C123GH6PM datasheet
+ * and the component datasheets. They should be calibrated against measurements of a specific board.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include <stdint.h>
+
+enum Energy_Power_Modes
+{
+	ENERGY_MODE_RUN             = 0x00,
+	ENERGY_MODE_SLEEP           = 0x01,
+	ENERGY_MODE_DEEP_SLEEP      = 0x02,
+	ENERGY_MODE_COUNT           = 0x03
+};
+
+// Peripheral types in the same order as Clock_Peripherals
+enum Energy_Peripherals
+{
+	ENERGY_PERIPHERAL_GPIO          = 0x00,
+	ENERGY_PERIPHERAL_TIMER         = 0x01,
+	ENERGY_PERIPHERAL_WIDE_TIMER    = 0x02,
+	ENERGY_PERIPHERAL_SSI           = 0x03,
+	ENERGY_PERIPHERAL_PWM           = 0x04,
+	ENERGY_PERIPHERAL_DMA           = 0x05,
+	ENERGY_PERIPHERAL_EEPROM        = 0x06,
+	ENERGY_PERIPHERAL_UART          = 0x07,
+	ENERGY_PERIPHERAL_COUNT         = 0x08
+};
+
+enum Energy_Loads
+{
+	ENERGY_LOAD_LED             = 0x00,
+	ENERGY_LOAD_BUZZER          = 0x01,
+	ENERGY_LOAD_STEPPER_COIL    = 0x02,
+	ENERGY_LOAD_COUNT           = 0x03
+};
+
+typedef struct
+{
+	// Voltage of the supply that all currents are referred to (in mV)
+	uint32_t supply_voltage_mV;
+
+	// Current drawn in each power mode, excluding the peripherals (in uA and in uA per MHz)
+	uint32_t mode_base_uA[ENERGY_MODE_COUNT];
+	uint32_t mode_uA_per_MHz[ENERGY_MODE_COUNT];
+
+	// Current drawn by each enabled peripheral clock (in uA per MHz)
+	uint32_t peripheral_uA_per_MHz[ENERGY_PERIPHERAL_COUNT];
+
+	// Current drawn by each active load (in uA)
+	uint32_t load_uA[ENERGY_LOAD_COUNT];
+} Energy_Board;
+
+extern const Energy_Board EduBase_TM4C123_Board;
+
+/**
+ * @brief Initializes the estimator with the coefficients of a board.
+ *
+ * The accumulated time and energy are cleared. The initial state is the run mode at 50 MHz
+ * with no peripheral clocks enabled and no active loads.
+ *
+ * @param board A pointer to the coefficient table of the board.
+ *
+ * @return None
+ */
+void Energy_Estimator_Init(const Energy_Board* board);
+
+/**
+ * @brief Sets the power mode of the device.
+ *
+ * @param mode The power mode (e.g. ENERGY_MODE_SLEEP).
+ *
+ * @return None
+ */
+void Energy_Estimator_Set_Power_Mode(uint8_t mode);
+
+/**
+ * @brief Sets the frequency of the core clock.
+ *
+ * In deep-sleep mode, this is the frequency of the deep-sleep clock (e.g. 16 MHz for the PIOSC).
+ *
+ * @param clock_MHz The clock frequency (in MHz).
+ *
+ * @return None
+ */
+void Energy_Estimator_Set_Core_Clock(uint32_t clock_MHz);
+
+/**
+ * @brief Sets the number of enabled clocks of a peripheral type.
+ *
+ * In sleep and deep-sleep modes, this is the number of clocks enabled in the SCGC and DCGC registers.
+ *
+ * @param peripheral The peripheral type (e.g. ENERGY_PERIPHERAL_GPIO).
+ *
+ * @param count The number of enabled instances.
+ *
+ * @return None
+ */
+void Energy_Estimator_Set_Peripheral_Count(uint8_t peripheral, uint8_t count);
+
+/**
+ * @brief Sets the number of active loads of a type.
+ *
+ * @param load The load type (e.g. ENERGY_LOAD_LED).
+ *
+ * @param count The number of LEDs lit, 1 if the buzzer is driven, or the number of energized stepper motor coils.
+ *
+ * @return None
+ */
+void Energy_Estimator_Set_Load(uint8_t load, uint8_t count);
+
+/**
+ * @brief Returns the current drawn in the present state.
+ *
+ * @param None
+ *
+ * @return The estimated supply current (in uA).
+ */
+uint32_t Energy_Estimator_Get_Current_uA(void);
+
+/**
+ * @brief Accumulates the energy consumed while remaining in the present state.
+ *
+ * @param time_us The time spent in the present state (in us).
+ *
+ * @return None
+ */
+void Energy_Estimator_Advance(uint32_t time_us);
+
+/**
+ * @brief Returns the energy accumulated since initialization.
+ *
+ * @param None
+ *
+ * @return The estimated energy (in uJ).
+ */
+uint64_t Energy_Estimator_Get_Energy_uJ(void);
+
+/**
+ * @brief Returns the time accumulated in a power mode since initialization.
+ *
+ * @param mode The power mode (e.g. ENERGY_MODE_RUN).
+ *
+ * @return The time spent in the power mode (in us).
+ */
+uint64_t Energy_Estimator_Get_Mode_Time_us(uint8_t mode);
+
+/**
+ * @brief Returns the average current since initialization.
+ *
+ * @param None
+ *
+ * @return The average supply current (in uA), or 0 if no time has been accumulated.
+ */
+uint32_t Energy_Estimator_Get_Average_Current_uA(void);
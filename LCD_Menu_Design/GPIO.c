@@ -16,6 +16,7 @@
  */
 
 #include "GPIO.h"
+#include "Clock_Manager.h"
 
 // Constant definitions for the user LED (RGB) colors
 const uint8_t RGB_LED_OFF 		= 0x00;
@@ -27,28 +28,45 @@ const uint8_t RGB_LED_GREEN 	= 0x08;
 const uint8_t EDUBASE_LED_ALL_OFF = 0x0;
 const uint8_t EDUBASE_LED_ALL_ON	= 0xF;
 
+static uint8_t gpio_aperture_initialized = 0;
+
+void GPIO_Aperture_Init(void)
+{
+	// The apertures are only selected by the first call
+	if (gpio_aperture_initialized) return;
+
+	// Select the AHB or the APB aperture for Port A to Port F
+	// by writing to Bits 5 to 0 in the GPIOHBCTL register
+	SYSCTL->GPIOHBCTL = (SYSCTL->GPIOHBCTL & ~0x3F) | GPIO_AHB_PORTS;
+
+	gpio_aperture_initialized = 1;
+}
+
 void RGB_LED_Init(void)
 {
+	// Select the aperture used to access Port F
+	GPIO_Aperture_Init();
+	
 	// Enable the clock to Port F
-	SYSCTL->RCGCGPIO |= 0x20;
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_F);
 
 	// Set PF1, PF2, and PF3 as output GPIO pins
-	GPIOF->DIR |= 0x0E;
+	GPIO_PORT_F->DIR |= 0x0E;
 	
 	// Configure PF1, PF2, and PF3 to function as GPIO pins
-	GPIOF->AFSEL &= ~0x0E;
+	GPIO_PORT_F->AFSEL &= ~0x0E;
 	
 	// Enable digital functionality for PF1, PF2, and PF3
-	GPIOF->DEN |= 0x0E;
+	GPIO_PORT_F->DEN |= 0x0E;
 	
 	// Initialize the output of the RGB LED to zero
-	GPIOF->DATA &= ~0x0E;
+	GPIO_PORT_F->DATA &= ~0x0E;
 }
 
 void RGB_LED_Output(uint8_t led_value)
 {
 	// Set the output of the RGB LED
-	GPIOF->DATA = (GPIOF->DATA & 0xF1) | led_value;
+	GPIO_PORT_F->DATA = (GPIO_PORT_F->DATA & 0xF1) | led_value;
 }
 
 uint8_t RGB_LED_Status(void)
@@ -56,47 +74,53 @@ uint8_t RGB_LED_Status(void)
 	// Assign the value of Port F to a local variable
 	// and only read the values of the following bits: 3, 2, and 1
 	// Then, return the local variable's value
-	uint8_t RGB_LED_Status = GPIOF->DATA & 0x0E;
+	uint8_t RGB_LED_Status = GPIO_PORT_F->DATA & 0x0E;
 	return RGB_LED_Status;
 }
 
 void EduBase_LEDs_Init(void)
 {
+	// Select the aperture used to access Port B
+	GPIO_Aperture_Init();
+	
 	// Enable the clock to Port B
-	SYSCTL->RCGCGPIO |= 0x02;
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_B);
 	
 	// Set PB0, PB1, PB2, and PB3 as output GPIO pins
-	GPIOB->DIR |= 0x0F;
+	GPIO_PORT_B->DIR |= 0x0F;
 	
 	// Configure PB0, PB1, PB2, and PB3 to function as GPIO pins
-	GPIOB->AFSEL &= ~0x0F;
+	GPIO_PORT_B->AFSEL &= ~0x0F;
 	
 	// Enable digital functionality for PB0, PB1, PB2, and PB3
-	GPIOB->DEN |= 0x0F;
+	GPIO_PORT_B->DEN |= 0x0F;
 	
 	// Initialize the output of the EduBase LEDs to zero
-	GPIOB->DATA &= ~0x0F;
+	GPIO_PORT_B->DATA &= ~0x0F;
 }
 
 void EduBase_LEDs_Output(uint8_t led_value)
 {
 	// Set the output of the LEDs
-	GPIOB->DATA = (GPIOB->DATA & 0xF0) | led_value;
+	GPIO_PORT_B->DATA = (GPIO_PORT_B->DATA & 0xF0) | led_value;
 }
 
 void EduBase_Button_Init(void)
 {
+	// Select the aperture used to access Port D
+	GPIO_Aperture_Init();
+	
 	// Enable the clock to Port D
-	SYSCTL->RCGCGPIO |= 0x08;
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_D);
 	
 	// Set PD0, PD1, PD2, and PD3 as input GPIO pins
-	GPIOD->DIR &= ~0x0F;
+	GPIO_PORT_D->DIR &= ~0x0F;
 	
 	// Configure PD0, PD1, PD2, and PD3 to function as GPIO pins
-	GPIOD->AFSEL &= ~0x0F;
+	GPIO_PORT_D->AFSEL &= ~0x0F;
 	
 	// Enable digital functionality for PD0, PD1, PD2, and PD3
-	GPIOD->DEN |= 0x0F;
+	GPIO_PORT_D->DEN |= 0x0F;
 }
 
 uint8_t Get_EduBase_Button_Status(void)
@@ -104,7 +128,7 @@ uint8_t Get_EduBase_Button_Status(void)
 	// Assign the value of Port D to a local variable
 	// and only read the values of the following bits: 3, 2, 1, and 0
 	// Then, return the local variable's value
-	uint8_t button_status = GPIOD->DATA & 0x0F;
+	uint8_t button_status = GPIO_PORT_D->DATA & 0x0F;
 	return button_status;
 }
 
@@ -12,12 +12,85 @@
  * To verify the pinout of the user LED, refer to the Tiva C Series TM4C123G LaunchPad User's Guide
  * Link: https://www.ti.com/lit/pdf/spmu296
  *
+ * It also selects the aperture used to access each GPIO port. Each port can be accessed through the
+ * legacy Advanced Peripheral Bus (APB) aperture or through the Advanced High-Performance Bus (AHB) aperture,
+ * which requires fewer bus cycles per access. The drivers access the ports through the GPIO_PORT_A - GPIO_PORT_F
+ * macros, which point to the aperture selected with the GPIO_PORT_x_AHB macros.
+ *
+ * @note Once a port is switched to the AHB aperture, it no longer responds at its APB address.
+ * All of the drivers must therefore use the GPIO_PORT_x macros instead of GPIOA - GPIOF.
+ *
  * @author Aaron Nanas
  */
 
 #include "TM4C123GH6PM.h"
 #include "SysTick_Delay.h"
 
+// Set GPIO_PORT_x_AHB to 1 to access Port x through the AHB aperture, or to 0 to use the APB aperture
+#ifndef GPIO_PORT_A_AHB
+#define GPIO_PORT_A_AHB     1
+#endif
+
+#ifndef GPIO_PORT_B_AHB
+#define GPIO_PORT_B_AHB     1
+#endif
+
+#ifndef GPIO_PORT_C_AHB
+#define GPIO_PORT_C_AHB     1
+#endif
+
+#ifndef GPIO_PORT_D_AHB
+#define GPIO_PORT_D_AHB     1
+#endif
+
+#ifndef GPIO_PORT_E_AHB
+#define GPIO_PORT_E_AHB     1
+#endif
+
+#ifndef GPIO_PORT_F_AHB
+#define GPIO_PORT_F_AHB     1
+#endif
+
+#if GPIO_PORT_A_AHB
+#define GPIO_PORT_A         GPIOA_AHB
+#else
+#define GPIO_PORT_A         GPIOA
+#endif
+
+#if GPIO_PORT_B_AHB
+#define GPIO_PORT_B         GPIOB_AHB
+#else
+#define GPIO_PORT_B         GPIOB
+#endif
+
+#if GPIO_PORT_C_AHB
+#define GPIO_PORT_C         GPIOC_AHB
+#else
+#define GPIO_PORT_C         GPIOC
+#endif
+
+#if GPIO_PORT_D_AHB
+#define GPIO_PORT_D         GPIOD_AHB
+#else
+#define GPIO_PORT_D         GPIOD
+#endif
+
+#if GPIO_PORT_E_AHB
+#define GPIO_PORT_E         GPIOE_AHB
+#else
+#define GPIO_PORT_E         GPIOE
+#endif
+
+#if GPIO_PORT_F_AHB
+#define GPIO_PORT_F         GPIOF_AHB
+#else
+#define GPIO_PORT_F         GPIOF
+#endif
+
+// Value of the GPIOHBCTL register, where Bit 0 (Port A) to Bit 5 (Port F) select the AHB aperture
+#define GPIO_AHB_PORTS      ((GPIO_PORT_A_AHB << 0) | (GPIO_PORT_B_AHB << 1) | (GPIO_PORT_C_AHB << 2) | \
+                             (GPIO_PORT_D_AHB << 3) | (GPIO_PORT_E_AHB << 4) | (GPIO_PORT_F_AHB << 5))
+
 // Constant definitions for the user LED (RGB) colors
 extern const uint8_t RGB_LED_OFF;
 extern const uint8_t RGB_LED_RED;
@@ -28,6 +101,19 @@ extern const uint8_t RGB_LED_GREEN;
 extern const uint8_t EDUBASE_LED_ALL_OFF;
 extern const uint8_t EDUBASE_LED_ALL_ON;
 
+/**
+ * @brief The GPIO_Aperture_Init function selects the aperture used to access each GPIO port.
+ *
+ * This function writes GPIO_AHB_PORTS to the GPIOHBCTL register. It must be called before a port
+ * is accessed through the GPIO_PORT_x macros. It is called by the initialization function of each driver,
+ * but only the first call writes to the GPIOHBCTL register. The clock of the ports does not need to be enabled.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void GPIO_Aperture_Init(void);
+
 /**
  * @brief The RGB_LED_Init function initializes the RGB LED (PF1 - PF3)
  *
@@ -47,7 +133,7 @@ void RGB_LED_Init(void);
  * @brief The RGB_LED_Output function sets the output of the RGB LED.
  *
  * This function sets the output of the RGB LED based on the value of the input, led_value.
- * A bitwise AND operation (& 0xF1) is performed to mask the Bits 1 to 3 of the GPIOF's DATA register
+ * A bitwise AND operation (& 0xF1) is performed to mask the Bits 1 to 3 of Port F's DATA register
  * to preserve the state of other pins connected to Port F while keeping the RGB LED pins unaffected.
  * Then, a bitwise OR operation is performed with led_value to set the RGB LED pins to the desired state
  * specified by led_value.
@@ -102,7 +188,7 @@ void EduBase_LEDs_Init(void);
  * @brief The EduBase_LEDs_Output function sets the output of the EduBase Board LEDs.
  *
  * This function sets the output of the EduBase Board LEDs based on the value of the input, led_value.
- * A bitwise AND operation (& 0xF0) is performed to mask the lower four bits (Bits 0 to 3) of the GPIOF's DATA register
+ * A bitwise AND operation (& 0xF0) is performed to mask the lower four bits (Bits 0 to 3) of Port B's DATA register
  * to preserve the state of other pins connected to Port B while keeping the LED pins unaffected.
  * Then, a bitwise OR operation is performed with led_value to set the LED pins to the desired state
  * specified by led_value.
@@ -0,0 +1,100 @@
+/**
+ * @file GPIO_Benchmark.c
+ *
+ * @brief Source code for the GPIO_Benchmark driver.
+ *
+ * This file contains the function definitions for the GPIO_Benchmark driver.
+ * It measures the cost of accessing the GPIO ports through the legacy Advanced Peripheral Bus (APB) aperture
+ * and through the Advanced High-Performance Bus (AHB) aperture (see GPIO.h). The following are measured
+ * with the DWT cycle counter on both apertures:
+ *  - Toggle rate of the PB0 pin (EduBase Board LED0) using a read-modify-write of the DATA register
+ *  - Nibble throughput of the EduBase Board LCD, using the same register accesses as EduBase_LCD_Write_4_Bits
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "GPIO_Benchmark.h"
+#include "GPIO.h"
+
+#define SYSTEM_CLOCK_HZ     50000000UL
+
+// Ports used by the benchmark (A, C and E for the LCD, B for LED0)
+#define BENCHMARK_PORTS     0x17
+
+static void GPIO_Benchmark_Measure(GPIOA_Type* port_a, GPIOA_Type* port_b, GPIOA_Type* port_c, GPIOA_Type* port_e, GPIO_Benchmark_Result* result)
+{
+	uint32_t start_cycles = DWT->CYCCNT;
+
+	// Toggle PB0 eight times per iteration to reduce the overhead of the loop
+	for (uint32_t i = 0; i < GPIO_BENCHMARK_ITERATIONS; i = i + 8)
+	{
+		port_b->DATA ^= 0x01;
+		port_b->DATA ^= 0x01;
+		port_b->DATA ^= 0x01;
+		port_b->DATA ^= 0x01;
+		port_b->DATA ^= 0x01;
+		port_b->DATA ^= 0x01;
+		port_b->DATA ^= 0x01;
+		port_b->DATA ^= 0x01;
+	}
+
+	uint32_t toggle_cycles = DWT->CYCCNT - start_cycles;
+
+	start_cycles = DWT->CYCCNT;
+
+	for (uint32_t i = 0; i < GPIO_BENCHMARK_ITERATIONS; i++)
+	{
+		// Set the nibble on the data pins (PA2 - PA5) and the register select pin (PE0)
+		port_a->DATA |= (i & 0x0F) << 2;
+		port_e->DATA |= 0x01;
+
+		// Access the enable pin (PC6) as many times as EduBase_LCD_Pulse_Enable without raising it
+		port_c->DATA &= ~0x40;
+		port_c->DATA &= ~0x40;
+		port_c->DATA &= ~0x40;
+
+		// Clear the data pins
+		port_a->DATA &= ~0x3C;
+	}
+
+	uint32_t nibble_cycles = DWT->CYCCNT - start_cycles;
+
+	result->toggle_cycles = toggle_cycles / GPIO_BENCHMARK_ITERATIONS;
+	result->toggle_rate_hz = (uint32_t)(((uint64_t)SYSTEM_CLOCK_HZ * GPIO_BENCHMARK_ITERATIONS) / toggle_cycles);
+	result->nibble_cycles = nibble_cycles / GPIO_BENCHMARK_ITERATIONS;
+	result->nibble_rate_hz = (uint32_t)(((uint64_t)SYSTEM_CLOCK_HZ * GPIO_BENCHMARK_ITERATIONS) / nibble_cycles);
+}
+
+void GPIO_Benchmark_Run(GPIO_Benchmark_Result* apb_result, GPIO_Benchmark_Result* ahb_result)
+{
+	// Enable the DWT cycle counter
+	// by setting the TRCENA bit (Bit 24) in the DEMCR register and the CYCCNTENA bit (Bit 0) in the DWT CTRL register
+	CoreDebug->DEMCR |= (1UL << 24);
+	DWT->CTRL |= 0x01;
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	// Save the state of the register select pin (PE0) and the apertures selected by GPIO_Aperture_Init
+	uint32_t register_select = GPIO_PORT_E->DATA & 0x01;
+	uint32_t saved_apertures = SYSCTL->GPIOHBCTL;
+
+	// Access Ports A, B, C and E through the APB aperture
+	// by clearing the corresponding bits in the GPIOHBCTL register
+	SYSCTL->GPIOHBCTL &= ~BENCHMARK_PORTS;
+	GPIO_Benchmark_Measure(GPIOA, GPIOB, GPIOC, GPIOE, apb_result);
+
+	// Access Ports A, B, C and E through the AHB aperture
+	// by setting the corresponding bits in the GPIOHBCTL register
+	SYSCTL->GPIOHBCTL |= BENCHMARK_PORTS;
+	GPIO_Benchmark_Measure(GPIOA_AHB, GPIOB_AHB, GPIOC_AHB, GPIOE_AHB, ahb_result);
+
+	// Restore the apertures selected in GPIO.h
+	SYSCTL->GPIOHBCTL = saved_apertures;
+
+	// Restore the register select pin
+	// PB0 has been toggled an even number of times, so it does not need to be restored
+	GPIO_PORT_E->DATA = (GPIO_PORT_E->DATA & ~0x01) | register_select;
+
+	__set_PRIMASK(primask);
+}
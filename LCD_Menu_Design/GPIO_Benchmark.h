@@ -0,0 +1,56 @@
+/**
+ * @file GPIO_Benchmark.h
+ *
+ * @brief Header file for the GPIO_Benchmark driver.
+ *
+ * This file contains the function definitions for the GPIO_Benchmark driver.
+ * It measures the cost of accessing the GPIO ports through the legacy Advanced Peripheral Bus (APB) aperture
+ * and through the Advanced High-Performance Bus (AHB) aperture (see GPIO.h). The following are measured
+ * with the DWT cycle counter on both apertures:
+ *  - Toggle rate of the PB0 pin (EduBase Board LED0) using a read-modify-write of the DATA register
+ *  - Nibble throughput of the EduBase Board LCD, using the same register accesses as EduBase_LCD_Write_4_Bits
+ *
+ * The nibble throughput only includes the register accesses. The LCD driver also waits 1 ms after each nibble,
+ * which is not measured. The LCD enable pin (PC6) is kept low while measuring, so the LCD does not receive the nibbles.
+ *
+ * @note The LCD and the EduBase Board LEDs must be initialized before running the benchmark.
+ * It must not be run while the LCD is updated with the EduBase_LCD_DMA driver.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+// Set GPIO_BENCHMARK_ENABLE to 1 in the project options to show the benchmark results at startup
+#ifndef GPIO_BENCHMARK_ENABLE
+#define GPIO_BENCHMARK_ENABLE           0
+#endif
+
+// Number of toggles and nibbles measured on each aperture
+#define GPIO_BENCHMARK_ITERATIONS       1024
+
+typedef struct
+{
+	uint32_t toggle_cycles;
+	uint32_t toggle_rate_hz;
+	uint32_t nibble_cycles;
+	uint32_t nibble_rate_hz;
+} GPIO_Benchmark_Result;
+
+/**
+ * @brief Measures the toggle rate and the LCD nibble throughput on both GPIO apertures.
+ *
+ * Ports A, B, C and E are temporarily switched to each aperture with the GPIOHBCTL register.
+ * Interrupts are disabled during the measurement because the interrupt service routines access
+ * the ports through the aperture selected in GPIO.h. The GPIOHBCTL register and the state of the pins
+ * are restored before returning.
+ *
+ * @param apb_result A pointer to the results for the APB aperture.
+ *
+ * @param ahb_result A pointer to the results for the AHB aperture.
+ *
+ * @return None
+ */
+void GPIO_Benchmark_Run(GPIO_Benchmark_Result* apb_result, GPIO_Benchmark_Result* ahb_result);
@@ -0,0 +1,259 @@
+/**
+ * @file Gesture.c
+ *
+ * @brief Source code for the Gesture driver.
+ *
+ * This file contains the function definitions for the Gesture driver.
+ * It recognizes the following gestures on push buttons (e.g. the PMOD ENC button,
+ * the PMOD BTN module or the EduBase Board push buttons):
+ *  - Short press:       The button is released before GESTURE_LONG_PRESS_MS and is not pressed
+ *                       again within GESTURE_DOUBLE_CLICK_MS
+ *  - Long press:        The button is held for GESTURE_LONG_PRESS_MS (reported while it is still held)
+ *  - Double click:      The button is pressed again within GESTURE_DOUBLE_CLICK_MS after a short press
+ *                       and released before GESTURE_LONG_PRESS_MS
+ *  - Press and rotate:  The rotary encoder is turned while the button is held (reported for every detent)
+ *
+ * Button edges are recorded by Gesture_Input_Update. An edge is only accepted once the input has kept
+ * its new state for GESTURE_DEBOUNCE_MS, so that contact bounce does not start a second press.
+ * A single shared 1 ms tick (Gesture_Tick) advances the timestamp and only checks the inputs that
+ * are being debounced or have a pending deadline. Each input uses 4 bytes of state.
+ * Recognized gestures are stored in an event queue that is read with Gesture_Get_Event.
+ *
+ * @note Gesture_Tick must be called every 1 ms (e.g. from the Timer 0A periodic task).
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Gesture.h"
+
+enum Gesture_Input_States
+{
+	INPUT_IDLE              = 0x00,
+	INPUT_PRESSED           = 0x01,
+	INPUT_WAIT_SECOND_PRESS = 0x02,
+	INPUT_SECOND_PRESS      = 0x03,
+	INPUT_CONSUMED          = 0x04
+};
+
+// The levels field holds the debounced state (Bit 7), the last reported state (Bit 6)
+// and the number of milliseconds the last reported state has been stable (Bits 5 to 0)
+#define INPUT_LEVEL_PRESSED     0x80
+#define INPUT_LEVEL_RAW         0x40
+#define INPUT_LEVEL_STABLE_MS   0x3F
+
+typedef struct
+{
+	uint16_t timestamp;
+	uint8_t state;
+	uint8_t levels;
+} Gesture_Input;
+
+static Gesture_Input gesture_inputs[GESTURE_MAX_INPUTS];
+
+// Shared time base in milliseconds. Elapsed times are computed with 16-bit
+// wrap-around arithmetic, which is sufficient for deadlines shorter than 65 seconds
+static volatile uint16_t gesture_time_ms = 0;
+
+// Bit mask of the inputs that have a pending deadline
+static volatile uint32_t gesture_pending_mask = 0;
+
+// Bit mask of the inputs whose last reported state differs from their debounced state
+static volatile uint32_t gesture_debounce_mask = 0;
+
+static Gesture_Event gesture_queue[GESTURE_QUEUE_SIZE];
+static volatile uint8_t gesture_queue_head = 0;
+static volatile uint8_t gesture_queue_tail = 0;
+
+static void Gesture_Queue_Event(uint8_t input, uint8_t gesture, int8_t rotation)
+{
+	// The queue can be written from interrupts with different priorities
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	uint8_t next_head = (gesture_queue_head + 1) & (GESTURE_QUEUE_SIZE - 1);
+
+	// Drop the event if the queue is full
+	if (next_head != gesture_queue_tail)
+	{
+		gesture_queue[gesture_queue_head].input = input;
+		gesture_queue[gesture_queue_head].gesture = gesture;
+		gesture_queue[gesture_queue_head].rotation = rotation;
+		gesture_queue_head = next_head;
+	}
+
+	__set_PRIMASK(primask);
+}
+
+void Gesture_Init(void)
+{
+	for (int i = 0; i < GESTURE_MAX_INPUTS; i++)
+	{
+		gesture_inputs[i].timestamp = 0;
+		gesture_inputs[i].state = INPUT_IDLE;
+		gesture_inputs[i].levels = 0;
+	}
+
+	gesture_pending_mask = 0;
+	gesture_debounce_mask = 0;
+	gesture_queue_head = 0;
+	gesture_queue_tail = 0;
+}
+
+static void Gesture_Input_Change(uint8_t input, uint8_t pressed)
+{
+	Gesture_Input* state = &gesture_inputs[input];
+	uint16_t now = gesture_time_ms;
+
+	if (pressed)
+	{
+		if (state->state == INPUT_WAIT_SECOND_PRESS)
+		{
+			// The second press has started before the double click window has expired
+			// The double click is reported on release so that it can still become a press and rotate
+			// or a long press
+			state->state = INPUT_SECOND_PRESS;
+		}
+		else
+		{
+			state->state = INPUT_PRESSED;
+		}
+
+		// Start measuring the press and arm the long press deadline
+		state->timestamp = now;
+		gesture_pending_mask |= (1UL << input);
+	}
+	else
+	{
+		if (state->state == INPUT_PRESSED)
+		{
+			// Wait for a possible second press before reporting a short press
+			state->state = INPUT_WAIT_SECOND_PRESS;
+			state->timestamp = now;
+			gesture_pending_mask |= (1UL << input);
+		}
+		else
+		{
+			if (state->state == INPUT_SECOND_PRESS)
+			{
+				Gesture_Queue_Event(input, GESTURE_DOUBLE_CLICK, 0);
+			}
+
+			state->state = INPUT_IDLE;
+			gesture_pending_mask &= ~(1UL << input);
+		}
+	}
+}
+
+void Gesture_Input_Update(uint8_t input, uint8_t pressed)
+{
+	if (input >= GESTURE_MAX_INPUTS) return;
+
+	Gesture_Input* state = &gesture_inputs[input];
+	uint8_t raw_level = pressed ? INPUT_LEVEL_RAW : 0;
+
+	// Gesture_Tick can preempt a GPIO interrupt that reports the state of an input
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	// Ignore calls that do not change the state of the input
+	if (raw_level != (state->levels & INPUT_LEVEL_RAW))
+	{
+		// Restart the debounce time
+		uint8_t debounced_level = state->levels & INPUT_LEVEL_PRESSED;
+		state->levels = debounced_level | raw_level;
+
+		if ((raw_level != 0) != (debounced_level != 0))
+		{
+			gesture_debounce_mask |= (1UL << input);
+		}
+		else
+		{
+			// The input has bounced back to its debounced state
+			gesture_debounce_mask &= ~(1UL << input);
+		}
+	}
+
+	__set_PRIMASK(primask);
+}
+
+uint8_t Gesture_Input_Rotate(uint8_t input, int rotation)
+{
+	if (input >= GESTURE_MAX_INPUTS || rotation == 0) return 0;
+
+	Gesture_Input* state = &gesture_inputs[input];
+
+	if (!(state->levels & INPUT_LEVEL_PRESSED)) return 0;
+
+	// The press is consumed by the rotation and will not be reported when the button is released
+	state->state = INPUT_CONSUMED;
+	gesture_pending_mask &= ~(1UL << input);
+
+	Gesture_Queue_Event(input, GESTURE_PRESS_AND_ROTATE, (int8_t)rotation);
+
+	return 1;
+}
+
+void Gesture_Tick(void)
+{
+	gesture_time_ms = gesture_time_ms + 1;
+
+	uint32_t debounce_mask = gesture_debounce_mask;
+
+	// Accept the edges of the inputs that have been stable for GESTURE_DEBOUNCE_MS
+	while (debounce_mask != 0)
+	{
+		uint8_t input = (uint8_t)__CLZ(__RBIT(debounce_mask));
+		debounce_mask &= debounce_mask - 1;
+
+		Gesture_Input* state = &gesture_inputs[input];
+		uint8_t stable_ms = (state->levels & INPUT_LEVEL_STABLE_MS) + 1;
+
+		if (stable_ms >= GESTURE_DEBOUNCE_MS)
+		{
+			uint8_t pressed = (state->levels & INPUT_LEVEL_RAW) != 0;
+			state->levels = pressed ? (INPUT_LEVEL_PRESSED | INPUT_LEVEL_RAW) : 0;
+			gesture_debounce_mask &= ~(1UL << input);
+			Gesture_Input_Change(input, pressed);
+		}
+		else
+		{
+			state->levels = (state->levels & ~INPUT_LEVEL_STABLE_MS) | stable_ms;
+		}
+	}
+
+	uint32_t pending_mask = gesture_pending_mask;
+
+	// Only visit the inputs that have a pending deadline
+	while (pending_mask != 0)
+	{
+		// Find the index of the lowest set bit by reversing the bits and counting leading zeros
+		uint8_t input = (uint8_t)__CLZ(__RBIT(pending_mask));
+		pending_mask &= pending_mask - 1;
+
+		Gesture_Input* state = &gesture_inputs[input];
+		uint16_t elapsed_ms = (uint16_t)(gesture_time_ms - state->timestamp);
+
+		if ((state->state == INPUT_PRESSED || state->state == INPUT_SECOND_PRESS) && elapsed_ms >= GESTURE_LONG_PRESS_MS)
+		{
+			Gesture_Queue_Event(input, GESTURE_LONG_PRESS, 0);
+			state->state = INPUT_CONSUMED;
+			gesture_pending_mask &= ~(1UL << input);
+		}
+		else if (state->state == INPUT_WAIT_SECOND_PRESS && elapsed_ms >= GESTURE_DOUBLE_CLICK_MS)
+		{
+			Gesture_Queue_Event(input, GESTURE_SHORT_PRESS, 0);
+			state->state = INPUT_IDLE;
+			gesture_pending_mask &= ~(1UL << input);
+		}
+	}
+}
+
+uint8_t Gesture_Get_Event(Gesture_Event* event)
+{
+	if (gesture_queue_tail == gesture_queue_head) return 0;
+
+	*event = gesture_queue[gesture_queue_tail];
+	gesture_queue_tail = (gesture_queue_tail + 1) & (GESTURE_QUEUE_SIZE - 1);
+
+	return 1;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file Gesture.h
+ *
+ * @brief Header file for the Gesture driver.
+ *
+ * This file contains the function definitions for the Gesture driver.
+ * It recognizes the following gestures on push buttons (e.g. the PMOD ENC button,
+ * the PMOD BTN module or the EduBase Board push buttons):
+ *  - Short press:       The button is released before GESTURE_LONG_PRESS_MS and is not pressed
+ *                       again within GESTURE_DOUBLE_CLICK_MS
+ *  - Long press:        The button is held for GESTURE_LONG_PRESS_MS (reported while it is still held)
+ *  - Double click:      The button is pressed again within GESTURE_DOUBLE_CLICK_MS after a short press
+ *                       and released before GESTURE_LONG_PRESS_MS
+ *  - Press and rotate:  The rotary encoder is turned while the button is held (reported for every detent)
+ *
+ * Button edges are recorded by Gesture_Input_Update. An edge is only accepted once the input has kept
+ * its new state for GESTURE_DEBOUNCE_MS, so that contact bounce does not start a second press.
+ * A single shared 1 ms tick (Gesture_Tick) advances the timestamp and only checks the inputs that
+ * are being debounced or have a pending deadline. Each input uses 4 bytes of state.
+ * Recognized gestures are stored in an event queue that is read with Gesture_Get_Event.
+ *
+ * @note Gesture_Tick must be called every 1 ms (e.g. from the Timer 0A periodic task).
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+// Maximum number of inputs (one bit per input is used to track pending deadlines)
+#define GESTURE_MAX_INPUTS          32
+
+// Time an input must remain in its new state before the edge is accepted
+// (at most 63 ms, since the debounce time is stored in 6 bits)
+#define GESTURE_DEBOUNCE_MS         5
+
+#define GESTURE_LONG_PRESS_MS       600
+#define GESTURE_DOUBLE_CLICK_MS     250
+
+// Number of events that can be queued before new events are dropped (must be a power of two)
+#define GESTURE_QUEUE_SIZE          16
+
+enum Gesture_Types
+{
+	GESTURE_SHORT_PRESS         = 0x01,
+	GESTURE_LONG_PRESS          = 0x02,
+	GESTURE_DOUBLE_CLICK        = 0x03,
+	GESTURE_PRESS_AND_ROTATE    = 0x04
+};
+
+typedef struct
+{
+	uint8_t input;
+	uint8_t gesture;
+	int8_t rotation;
+} Gesture_Event;
+
+/**
+ * @brief Initializes the state of every input and clears the event queue.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Gesture_Init(void);
+
+/**
+ * @brief Records the state of an input.
+ *
+ * This function should be called whenever the state of the input may have changed,
+ * either from a GPIO interrupt or from a periodic sampling task. Calls that do not change
+ * the state of the input are ignored. The new state is applied by Gesture_Tick once it has been
+ * stable for GESTURE_DEBOUNCE_MS.
+ *
+ * @param input The index of the input (0 to GESTURE_MAX_INPUTS - 1).
+ *
+ * @param pressed Set to 1 if the button is pressed. Otherwise, set to 0.
+ *
+ * @return None
+ */
+void Gesture_Input_Update(uint8_t input, uint8_t pressed);
+
+/**
+ * @brief Reports a rotation of the rotary encoder associated with an input.
+ *
+ * If the button is held, a press and rotate event is queued and the press will not
+ * be reported as a short press, long press, or double click.
+ *
+ * @param input The index of the input (0 to GESTURE_MAX_INPUTS - 1).
+ *
+ * @param rotation The rotation returned by PMOD_ENC_Get_Rotation (1 or -1).
+ *
+ * @return Returns 1 if the rotation was consumed by a press and rotate gesture. Otherwise, it returns 0.
+ */
+uint8_t Gesture_Input_Rotate(uint8_t input, int rotation);
+
+/**
+ * @brief Advances the shared time base by 1 ms and processes the pending deadlines.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Gesture_Tick(void);
+
+/**
+ * @brief Removes the oldest event from the event queue.
+ *
+ * @param event A pointer to the structure that will receive the event.
+ *
+ * @return Returns 1 if an event was read, or 0 if the queue is empty.
+ */
+uint8_t Gesture_Get_Event(Gesture_Event* event);
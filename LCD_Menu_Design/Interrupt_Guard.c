@@ -0,0 +1,236 @@
+/**
+ * @file Interrupt_Guard.c
+ *
+ * @brief Source code for the Interrupt_Guard driver.
+ *
+ * This file contains the function definitions for the Interrupt_Guard driver.
+ * It limits the rate of the GPIO edge interrupts generated by each source (e.g. the PMOD BTN module on Port A).
+ * If a source exceeds its storm threshold, its pins are masked and polled every 1 ms until they are calm again.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Interrupt_Guard.h"
+
+typedef struct
+{
+	GPIOA_Type* port;
+	uint8_t pins;
+	void (*poll_task)(void);
+
+	uint16_t storm_threshold;
+	uint16_t calm_threshold;
+
+	volatile uint8_t polling;
+	volatile uint32_t window_interrupts;
+	uint32_t window_changes;
+	uint8_t calm_windows;
+	uint8_t last_pins;
+	uint8_t last_polled_pins;
+
+	volatile uint32_t interrupt_count;
+	uint32_t peak_rate;
+	uint32_t storm_count;
+	uint32_t polled_event_count;
+} Interrupt_Guard_Source;
+
+static Interrupt_Guard_Source sources[INTERRUPT_GUARD_SOURCES];
+
+static uint32_t window_ms = 0;
+static uint32_t poll_ms = 0;
+
+// Unmasks the pins of a polled source
+static void Interrupt_Guard_Unmask(Interrupt_Guard_Source* guard)
+{
+	// Clear the edges latched while the pins were masked, so they do not generate an interrupt
+	guard->port->ICR = guard->pins;
+	guard->port->IM |= guard->pins;
+
+	guard->polling = 0;
+	guard->window_interrupts = 0;
+}
+
+void Interrupt_Guard_Init(uint8_t source, GPIOA_Type* port, uint8_t pins, void(*poll_task)(void))
+{
+	if (source >= INTERRUPT_GUARD_SOURCES) return;
+
+	Interrupt_Guard_Source* guard = &sources[source];
+
+	guard->port = port;
+	guard->pins = pins;
+	guard->poll_task = poll_task;
+	guard->storm_threshold = INTERRUPT_GUARD_DEFAULT_STORM_THRESHOLD;
+	guard->calm_threshold = INTERRUPT_GUARD_DEFAULT_CALM_THRESHOLD;
+	guard->polling = 0;
+	guard->window_interrupts = 0;
+	guard->window_changes = 0;
+	guard->calm_windows = 0;
+	guard->interrupt_count = 0;
+	guard->peak_rate = 0;
+	guard->storm_count = 0;
+	guard->polled_event_count = 0;
+}
+
+void Interrupt_Guard_Set_Thresholds(uint8_t source, uint16_t storm_threshold, uint16_t calm_threshold)
+{
+	if (source >= INTERRUPT_GUARD_SOURCES) return;
+
+	sources[source].storm_threshold = storm_threshold;
+	sources[source].calm_threshold = calm_threshold;
+}
+
+uint8_t Interrupt_Guard_Count(uint8_t source)
+{
+	if (source >= INTERRUPT_GUARD_SOURCES) return 1;
+
+	Interrupt_Guard_Source* guard = &sources[source];
+
+	// The windows are updated by Interrupt_Guard_Tick, which can preempt the interrupt service routine
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	guard->interrupt_count = guard->interrupt_count + 1;
+	guard->window_interrupts = guard->window_interrupts + 1;
+
+	if (guard->polling || guard->port == 0)
+	{
+		__set_PRIMASK(primask);
+		return 0;
+	}
+
+	if (guard->window_interrupts > guard->storm_threshold)
+	{
+		// Mask the pins of the source and clear their pending interrupts
+		guard->port->IM &= ~guard->pins;
+		guard->port->ICR = guard->pins;
+
+		// Start polling from the current state of the pins
+		guard->last_pins = guard->port->DATA & guard->pins;
+		guard->last_polled_pins = guard->last_pins;
+		guard->window_changes = 0;
+		guard->calm_windows = 0;
+		guard->polling = 1;
+		guard->storm_count = guard->storm_count + 1;
+
+		__set_PRIMASK(primask);
+		return 0;
+	}
+
+	__set_PRIMASK(primask);
+	return 1;
+}
+
+void Interrupt_Guard_Tick(void)
+{
+	uint8_t window_end = 0;
+	uint8_t poll_end = 0;
+
+	window_ms = window_ms + 1;
+	if (window_ms >= INTERRUPT_GUARD_WINDOW_MS)
+	{
+		window_ms = 0;
+		window_end = 1;
+	}
+
+	poll_ms = poll_ms + 1;
+	if (poll_ms >= INTERRUPT_GUARD_POLL_PERIOD_MS)
+	{
+		poll_ms = 0;
+		poll_end = 1;
+	}
+
+	for (uint8_t i = 0; i < INTERRUPT_GUARD_SOURCES; i++)
+	{
+		Interrupt_Guard_Source* guard = &sources[i];
+
+		if (guard->port == 0) continue;
+
+		if (guard->polling)
+		{
+			// Count the samples in which any of the pins has changed
+			uint8_t pins = guard->port->DATA & guard->pins;
+
+			if (pins != guard->last_pins)
+			{
+				guard->window_changes = guard->window_changes + 1;
+				guard->last_pins = pins;
+			}
+
+			// Execute the task if a pin has risen since the last poll
+			if (poll_end)
+			{
+				if (pins & ~guard->last_polled_pins)
+				{
+					guard->polled_event_count = guard->polled_event_count + 1;
+					(*guard->poll_task)();
+				}
+
+				guard->last_polled_pins = pins;
+			}
+
+			if (window_end)
+			{
+				if (guard->window_changes <= guard->calm_threshold)
+				{
+					guard->calm_windows = guard->calm_windows + 1;
+				}
+				else
+				{
+					guard->calm_windows = 0;
+				}
+
+				guard->window_changes = 0;
+
+				if (guard->calm_windows >= INTERRUPT_GUARD_CALM_WINDOWS)
+				{
+					Interrupt_Guard_Unmask(guard);
+				}
+			}
+		}
+
+		if (window_end)
+		{
+			if (guard->window_interrupts > guard->peak_rate)
+			{
+				guard->peak_rate = guard->window_interrupts;
+			}
+
+			guard->window_interrupts = 0;
+		}
+	}
+}
+
+uint8_t Interrupt_Guard_Is_Polling(uint8_t source)
+{
+	if (source >= INTERRUPT_GUARD_SOURCES) return 0;
+
+	return sources[source].polling;
+}
+
+uint32_t Interrupt_Guard_Get_Interrupt_Count(uint8_t source)
+{
+	if (source >= INTERRUPT_GUARD_SOURCES) return 0;
+
+	return sources[source].interrupt_count;
+}
+
+uint32_t Interrupt_Guard_Get_Peak_Rate(uint8_t source)
+{
+	if (source >= INTERRUPT_GUARD_SOURCES) return 0;
+
+	return sources[source].peak_rate;
+}
+
+uint32_t Interrupt_Guard_Get_Storm_Count(uint8_t source)
+{
+	if (source >= INTERRUPT_GUARD_SOURCES) return 0;
+
+	return sources[source].storm_count;
+}
+
+uint32_t Interrupt_Guard_Get_Polled_Event_Count(uint8_t source)
+{
+	if (source >= INTERRUPT_GUARD_SOURCES) return 0;
+
+	return sources[source].polled_event_count;
+}
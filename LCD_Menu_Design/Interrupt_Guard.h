@@ -0,0 +1,143 @@
+/**
+ * @file Interrupt_Guard.h
+ *
+ * @brief Header file for the Interrupt_Guard driver.
+ *
+ * This file contains the function definitions for the Interrupt_Guard driver.
+ * It limits the rate of the GPIO edge interrupts generated by each source (e.g. the PMOD BTN module on Port A).
+ * A bouncing contact or a floating input can generate thousands of interrupts per second, which would
+ * otherwise prevent the main loop from running.
+ *
+ * The interrupt service routine of each source calls Interrupt_Guard_Count, which counts the interrupts
+ * received during the current window of INTERRUPT_GUARD_WINDOW_MS. If a source exceeds its storm threshold
+ * within a window, its pins are masked in the IM register and the source is polled instead:
+ *  - The pins are sampled every 1 ms and the number of samples in which they changed is counted
+ *  - Every INTERRUPT_GUARD_POLL_PERIOD_MS, the task of the source is executed if a pin has risen since the last poll
+ *  - Once the pins have changed at most calm_threshold times per window for INTERRUPT_GUARD_CALM_WINDOWS
+ *    consecutive windows, the pending interrupts are cleared and the pins are unmasked again
+ *
+ * @note Interrupt_Guard_Tick must be called every 1 ms (e.g. from the Timer 0A periodic task).
+ * Otherwise, a source that has been masked is never unmasked.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+// Length of the window in which the interrupts of each source are counted (in ms)
+#define INTERRUPT_GUARD_WINDOW_MS                   100
+
+// Default number of interrupts per window above which a source is masked (500 interrupts per second)
+#define INTERRUPT_GUARD_DEFAULT_STORM_THRESHOLD     50
+
+// Default number of samples per window with a changed pin at or below which a polled source is considered calm
+#define INTERRUPT_GUARD_DEFAULT_CALM_THRESHOLD      2
+
+// Number of consecutive calm windows before a polled source is unmasked
+#define INTERRUPT_GUARD_CALM_WINDOWS                10
+
+// Time between two executions of the task of a polled source (in ms)
+#define INTERRUPT_GUARD_POLL_PERIOD_MS              10
+
+enum Interrupt_Guard_Sources
+{
+	INTERRUPT_GUARD_PMOD_BTN            = 0x00,
+	INTERRUPT_GUARD_EDUBASE_BUTTON      = 0x01,
+	INTERRUPT_GUARD_SOURCES             = 0x02
+};
+
+/**
+ * @brief Registers the pins of an interrupt source.
+ *
+ * The source uses the default thresholds and starts in interrupt mode.
+ *
+ * @param source The interrupt source (e.g. INTERRUPT_GUARD_PMOD_BTN).
+ *
+ * @param port A pointer to the GPIO port of the source (e.g. GPIO_PORT_A).
+ *
+ * @param pins The bit mask of the pins that generate the interrupts.
+ *
+ * @param poll_task A pointer to the function executed when a rising edge is detected while the source is polled.
+ *
+ * @return None
+ */
+void Interrupt_Guard_Init(uint8_t source, GPIOA_Type* port, uint8_t pins, void(*poll_task)(void));
+
+/**
+ * @brief Sets the thresholds of an interrupt source.
+ *
+ * @param source The interrupt source (e.g. INTERRUPT_GUARD_PMOD_BTN).
+ *
+ * @param storm_threshold The number of interrupts per window above which the source is masked.
+ *
+ * @param calm_threshold The number of samples per window with a changed pin at or below which the polled source is calm.
+ *
+ * @return None
+ */
+void Interrupt_Guard_Set_Thresholds(uint8_t source, uint16_t storm_threshold, uint16_t calm_threshold);
+
+/**
+ * @brief Counts an interrupt of a source and masks the source if it exceeds its storm threshold.
+ *
+ * This function must be called by the interrupt service routine of the source before its task is executed.
+ * If the source is masked, the pending interrupts of its pins are cleared.
+ *
+ * @param source The interrupt source (e.g. INTERRUPT_GUARD_PMOD_BTN).
+ *
+ * @return Returns 1 if the task of the source can be executed. Otherwise, it returns 0.
+ */
+uint8_t Interrupt_Guard_Count(uint8_t source);
+
+/**
+ * @brief Updates the interrupt windows and polls the masked sources.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Interrupt_Guard_Tick(void);
+
+/**
+ * @brief Indicates whether a source is masked and polled.
+ *
+ * @param source The interrupt source (e.g. INTERRUPT_GUARD_PMOD_BTN).
+ *
+ * @return Returns 1 if the source is polled. Otherwise, it returns 0.
+ */
+uint8_t Interrupt_Guard_Is_Polling(uint8_t source);
+
+/**
+ * @brief Returns the number of interrupts received from a source.
+ *
+ * @param source The interrupt source (e.g. INTERRUPT_GUARD_PMOD_BTN).
+ *
+ * @return The number of interrupts since the source was registered.
+ */
+uint32_t Interrupt_Guard_Get_Interrupt_Count(uint8_t source);
+
+/**
+ * @brief Returns the largest number of interrupts received from a source within one window.
+ *
+ * @param source The interrupt source (e.g. INTERRUPT_GUARD_PMOD_BTN).
+ *
+ * @return The peak number of interrupts per window.
+ */
+uint32_t Interrupt_Guard_Get_Peak_Rate(uint8_t source);
+
+/**
+ * @brief Returns the number of times a source has been masked.
+ *
+ * @param source The interrupt source (e.g. INTERRUPT_GUARD_PMOD_BTN).
+ *
+ * @return The number of interrupt storms detected.
+ */
+uint32_t Interrupt_Guard_Get_Storm_Count(uint8_t source);
+
+/**
+ * @brief Returns the number of times the task of a source has been executed while it was polled.
+ *
+ * @param source The interrupt source (e.g. INTERRUPT_GUARD_PMOD_BTN).
+ *
+ * @return The number of polled events.
+ */
+uint32_t Interrupt_Guard_Get_Polled_Event_Count(uint8_t source);
@@ -0,0 +1,187 @@
+/**
+ * @file LCD_Console.c
+ *
+ * @brief Source code for the LCD_Console driver.
+ *
+ * This file contains the function definitions for the LCD_Console driver.
+ * It shows a scrolling text console on the EduBase Board 16x2 Liquid Crystal Display (LCD).
+ * The lines are stored once in a ring buffer, and only the rows that show a different line are retransmitted.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "LCD_Console.h"
+#include "EduBase_LCD.h"
+#include "LCD_Page_Cache.h"
+#include "Display_Backend.h"
+
+// Number of a row that does not show any line, or whose contents are unknown
+#define ROW_BLANK       0xFFFFFFFF
+#define ROW_UNKNOWN     0xFFFFFFFE
+
+// Lines padded with spaces. Line n is stored in lines[n % LCD_CONSOLE_MAX_LINES]
+static char lines[LCD_CONSOLE_MAX_LINES][LCD_CONSOLE_COLUMNS];
+
+static volatile uint32_t line_count = 0;
+static volatile uint32_t scroll_offset = 0;
+
+// Number of the line shown on each row of the LCD
+static uint32_t row_lines[LCD_CONSOLE_ROWS];
+
+static uint32_t row_transfer_count = 0;
+
+// Set when the console takes over the LCD from another driver
+static uint8_t takeover_pending = 0;
+
+// Returns the number of lines that are stored in the ring buffer
+static uint32_t LCD_Console_Stored_Lines(void)
+{
+	return (line_count < LCD_CONSOLE_MAX_LINES) ? line_count : LCD_CONSOLE_MAX_LINES;
+}
+
+void LCD_Console_Init(void)
+{
+	line_count = 0;
+	scroll_offset = 0;
+	row_transfer_count = 0;
+
+	LCD_Console_Invalidate();
+}
+
+void LCD_Console_Add_Line(const char* line)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	char* slot = lines[line_count % LCD_CONSOLE_MAX_LINES];
+	uint8_t i = 0;
+
+	while (i < LCD_CONSOLE_COLUMNS && line[i] != '\0' && line[i] != '\n')
+	{
+		slot[i] = line[i];
+		i = i + 1;
+	}
+
+	while (i < LCD_CONSOLE_COLUMNS)
+	{
+		slot[i] = ' ';
+		i = i + 1;
+	}
+
+	line_count = line_count + 1;
+
+	// Keep the view on the same lines while it is scrolled back
+	if (scroll_offset > 0 && scroll_offset + LCD_CONSOLE_ROWS < LCD_Console_Stored_Lines())
+	{
+		scroll_offset = scroll_offset + 1;
+	}
+
+	__set_PRIMASK(primask);
+}
+
+void LCD_Console_Scroll(int32_t lines_to_scroll)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	uint32_t stored_lines = LCD_Console_Stored_Lines();
+	uint32_t max_offset = (stored_lines > LCD_CONSOLE_ROWS) ? (stored_lines - LCD_CONSOLE_ROWS) : 0;
+	int32_t offset = (int32_t)scroll_offset + lines_to_scroll;
+
+	if (offset < 0)
+	{
+		offset = 0;
+	}
+	else if ((uint32_t)offset > max_offset)
+	{
+		offset = (int32_t)max_offset;
+	}
+
+	scroll_offset = (uint32_t)offset;
+
+	__set_PRIMASK(primask);
+}
+
+uint8_t LCD_Console_Render(void)
+{
+	uint8_t rows_written = 0;
+
+	if (takeover_pending)
+	{
+		// Return the cursor to the first cell and undo any display shift so that
+		// the rows are written to the visible columns
+		EduBase_LCD_Send_Command(RETURN_HOME);
+
+		// The contents assumed by the other drivers are overwritten by the console
+		LCD_Page_Cache_Invalidate();
+		EduBase_LCD_Backend_Invalidate();
+
+		takeover_pending = 0;
+	}
+
+	for (uint8_t row = 0; row < LCD_CONSOLE_ROWS; row++)
+	{
+		char text[LCD_CONSOLE_COLUMNS + 1];
+		uint32_t line = ROW_BLANK;
+
+		// Copy the line shown on the row while no line can be added
+		uint32_t primask = __get_PRIMASK();
+		__disable_irq();
+
+		// The newest line is shown on the last row when the view is not scrolled back
+		uint32_t distance = scroll_offset + (LCD_CONSOLE_ROWS - 1 - row);
+
+		if (distance < LCD_Console_Stored_Lines())
+		{
+			line = line_count - 1 - distance;
+		}
+
+		if (line != row_lines[row])
+		{
+			for (uint8_t i = 0; i < LCD_CONSOLE_COLUMNS; i++)
+			{
+				text[i] = (line == ROW_BLANK) ? ' ' : lines[line % LCD_CONSOLE_MAX_LINES][i];
+			}
+		}
+
+		__set_PRIMASK(primask);
+
+		if (line == row_lines[row]) continue;
+
+		// Write the whole row, so that the previous line is overwritten
+		text[LCD_CONSOLE_COLUMNS] = '\0';
+		EduBase_LCD_Set_Cursor(0, row);
+		EduBase_LCD_Display_String(text);
+
+		row_lines[row] = line;
+		row_transfer_count = row_transfer_count + 1;
+		rows_written = rows_written + 1;
+	}
+
+	return rows_written;
+}
+
+void LCD_Console_Invalidate(void)
+{
+	for (uint8_t row = 0; row < LCD_CONSOLE_ROWS; row++)
+	{
+		row_lines[row] = ROW_UNKNOWN;
+	}
+
+	takeover_pending = 1;
+}
+
+uint32_t LCD_Console_Get_Scroll_Offset(void)
+{
+	return scroll_offset;
+}
+
+uint32_t LCD_Console_Get_Line_Count(void)
+{
+	return line_count;
+}
+
+uint32_t LCD_Console_Get_Row_Transfer_Count(void)
+{
+	return row_transfer_count;
+}
@@ -0,0 +1,123 @@
+/**
+ * @file LCD_Console.h
+ *
+ * @brief Header file for the LCD_Console driver.
+ *
+ * This file contains the function definitions for the LCD_Console driver.
+ * It shows a scrolling text console on the EduBase Board 16x2 Liquid Crystal Display (LCD), which can be used
+ * to display diagnostic messages on the device.
+ *
+ * Each line is stored once in a ring buffer of LCD_CONSOLE_MAX_LINES lines. Adding a line only copies it
+ * into the next slot of the ring, overwriting the oldest line when the ring is full. The two visible rows show
+ * the newest lines, and new lines scroll the rows up. LCD_Console_Scroll moves the view through the stored
+ * lines (e.g. when the rotary encoder is turned). While the view is scrolled back, it stays on the same lines
+ * when new lines are added.
+ *
+ * The number of the line shown on each row is kept, so LCD_Console_Render only retransmits the rows that
+ * now show a different line. Lines can be added from interrupt service routines. They only disable
+ * interrupts while a line is copied, and LCD_Console_Render does not keep interrupts disabled while it writes
+ * to the LCD, so producers are never stalled by the rendering.
+ *
+ * When the console takes over the LCD (after LCD_Console_Init or LCD_Console_Invalidate), the next call to
+ * LCD_Console_Render sends a Return Home command to undo a display shift left by another driver, and invalidates
+ * the LCD_Page_Cache and the EduBase LCD display backend, since their view of the LCD is overwritten.
+ *
+ * @note LCD_Console_Invalidate must be called after the LCD has been written without this driver
+ * (e.g. with EduBase_LCD_Send_Stream, EduBase_LCD_Clear_Display or LCD_Page_Cache_Show).
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+#define LCD_CONSOLE_COLUMNS     16
+#define LCD_CONSOLE_ROWS        2
+
+// Number of lines stored in the scrollback ring buffer
+#define LCD_CONSOLE_MAX_LINES   32
+
+/**
+ * @brief Clears the stored lines and the view.
+ *
+ * The LCD must be initialized with EduBase_LCD_Init before the console is rendered.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void LCD_Console_Init(void);
+
+/**
+ * @brief Adds a line to the console.
+ *
+ * The line ends at the first newline character or after LCD_CONSOLE_COLUMNS characters.
+ * The remaining characters are ignored.
+ *
+ * @param line The null-terminated line to be added.
+ *
+ * @return None
+ */
+void LCD_Console_Add_Line(const char* line);
+
+/**
+ * @brief Scrolls the view through the stored lines.
+ *
+ * The view is limited to the oldest and the newest stored lines.
+ *
+ * @param lines_to_scroll The number of lines to scroll back (positive) or forward (negative).
+ *
+ * @return None
+ */
+void LCD_Console_Scroll(int32_t lines_to_scroll);
+
+/**
+ * @brief Writes the rows that show a different line since the last call to the LCD.
+ *
+ * This function should be called from the main loop.
+ *
+ * @param None
+ *
+ * @return The number of rows that were written.
+ */
+uint8_t LCD_Console_Render(void);
+
+/**
+ * @brief Marks the rows as unknown, so that they are written by the next call to LCD_Console_Render.
+ *
+ * The next call to LCD_Console_Render also sends a Return Home command and invalidates
+ * the LCD_Page_Cache and the EduBase LCD display backend.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void LCD_Console_Invalidate(void);
+
+/**
+ * @brief Returns the number of lines that the view is scrolled back from the newest line.
+ *
+ * @param None
+ *
+ * @return The scroll offset (0 if the newest lines are shown).
+ */
+uint32_t LCD_Console_Get_Scroll_Offset(void);
+
+/**
+ * @brief Returns the number of lines added since initialization.
+ *
+ * Only the last LCD_CONSOLE_MAX_LINES lines are stored.
+ *
+ * @param None
+ *
+ * @return The number of lines added.
+ */
+uint32_t LCD_Console_Get_Line_Count(void);
+
+/**
+ * @brief Returns the number of rows written to the LCD.
+ *
+ * @param None
+ *
+ * @return The number of rows written since initialization.
+ */
+uint32_t LCD_Console_Get_Row_Transfer_Count(void);
@@ -0,0 +1,282 @@
+/**
+ * @file LCD_Page_Cache.c
+ *
+ * @brief Source code for the LCD_Page_Cache driver.
+ *
+ * This file contains the function definitions for the LCD_Page_Cache driver.
+ * It uses the off-screen Display Data RAM (DDRAM) of the EduBase Board 16x2 Liquid Crystal Display (LCD)
+ * to hold a second page, so that switching to that page only requires a few commands.
+ *
+ * The HD44780 stores 40 characters per row, but only 16 of them are visible. The DDRAM is divided into two slots:
+ *  - Slot 0 (Columns 0 - 15), which is visible after a Return Home command
+ *  - Slot 1 (Columns 16 - 31), which is visible after shifting the display to the left 16 times
+ *
+ * A page is a precompiled screen stream (see LCD_Screens.def). The next page is pre-rendered into the
+ * hidden slot with LCD_Page_Cache_Prefetch during idle time, a few cells per call. When a page is shown,
+ * the driver compares the number of commands needed to shift to the slot that already holds the page,
+ * to overwrite the changed cells of the visible slot, or to clear the LCD and write the page, and uses the cheapest option.
+ * A copy of the DDRAM is kept so that only the cells that differ are ever written.
+ *
+ * @note LCD_Page_Cache_Invalidate must be called after the LCD has been written without this driver
+ * (e.g. with EduBase_LCD_Send_Stream or EduBase_LCD_Clear_Display).
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "LCD_Page_Cache.h"
+#include "EduBase_LCD.h"
+
+// Budget that does not limit the number of commands
+#define UNLIMITED_BUDGET    0xFFFF
+
+// Copy of the DDRAM contents
+static char ddram[LCD_PAGE_CACHE_ROWS][LCD_PAGE_CACHE_DDRAM_COLUMNS];
+static uint8_t ddram_valid = 0;
+
+// Page that is completely stored in each slot, or 0 if the slot holds no complete page
+static const uint8_t* slot_pages[LCD_PAGE_CACHE_SLOTS];
+static uint8_t visible_slot = 0;
+
+static uint32_t transfer_count = 0;
+
+static void LCD_Page_Cache_Send_Command(uint8_t command)
+{
+	EduBase_LCD_Send_Command(command);
+	transfer_count = transfer_count + 1;
+}
+
+static void LCD_Page_Cache_Send_Data(uint8_t data)
+{
+	EduBase_LCD_Send_Data(data);
+	transfer_count = transfer_count + 1;
+}
+
+// Clears the LCD, which also removes any display shift
+static void LCD_Page_Cache_Clear(void)
+{
+	LCD_Page_Cache_Send_Command(CLEAR_DISPLAY);
+	memset(ddram, ' ', sizeof(ddram));
+
+	for (uint8_t slot = 0; slot < LCD_PAGE_CACHE_SLOTS; slot++)
+	{
+		slot_pages[slot] = 0;
+	}
+
+	visible_slot = 0;
+	ddram_valid = 1;
+}
+
+// Decodes a precompiled screen stream into the cells of a page
+// Cells beyond the visible columns are discarded
+static void LCD_Page_Cache_Decode(const uint8_t* page, char cells[LCD_PAGE_CACHE_ROWS][LCD_PAGE_CACHE_COLUMNS])
+{
+	uint8_t col = 0;
+	uint8_t row = 0;
+
+	memset(cells, ' ', LCD_PAGE_CACHE_ROWS * LCD_PAGE_CACHE_COLUMNS);
+
+	while (*page != LCD_STREAM_END)
+	{
+		if (*page == LCD_STREAM_COMMAND)
+		{
+			if (page[1] & SET_DDRAM_ADDR)
+			{
+				// The second row of the LCD starts at DDRAM address 0x40
+				row = (page[1] & 0x40) ? 1 : 0;
+				col = page[1] & 0x3F;
+			}
+			page = page + 2;
+		}
+		else
+		{
+			uint8_t length = page[1];
+
+			for (uint8_t i = 0; i < length; i++)
+			{
+				if ((col + i) < LCD_PAGE_CACHE_COLUMNS)
+				{
+					cells[row][col + i] = (char)page[2 + i];
+				}
+			}
+
+			col = col + length;
+			page = page + 2 + length;
+		}
+	}
+}
+
+// Writes the cells of a slot that differ from the page, using at most budget commands
+// If budget is 0, nothing is written and the number of commands that would be needed is returned
+// Otherwise, it returns the number of commands that are still needed after the budget has been used
+static uint32_t LCD_Page_Cache_Write_Slot(uint8_t slot, char cells[LCD_PAGE_CACHE_ROWS][LCD_PAGE_CACHE_COLUMNS], uint32_t budget)
+{
+	uint8_t count_only = (budget == 0);
+	uint32_t needed = 0;
+
+	for (uint8_t row = 0; row < LCD_PAGE_CACHE_ROWS; row++)
+	{
+		// Address of the next cell that the LCD will write to, or 0xFF if unknown
+		uint8_t next_col = 0xFF;
+
+		for (uint8_t col = 0; col < LCD_PAGE_CACHE_COLUMNS; col++)
+		{
+			uint8_t ddram_col = (slot * LCD_PAGE_CACHE_COLUMNS) + col;
+
+			if (cells[row][col] == ddram[row][ddram_col]) continue;
+
+			// The DDRAM address is only set at the start of a run of changed cells
+			uint32_t cost = (next_col != ddram_col) ? 2 : 1;
+
+			// Once the budget has been used, the remaining cells are only counted
+			if (count_only || budget < cost)
+			{
+				count_only = 1;
+				needed = needed + cost;
+				next_col = ddram_col + 1;
+				continue;
+			}
+
+			if (next_col != ddram_col)
+			{
+				LCD_Page_Cache_Send_Command(SET_DDRAM_ADDR | ((row * 0x40) + ddram_col));
+			}
+
+			LCD_Page_Cache_Send_Data(cells[row][col]);
+			ddram[row][ddram_col] = cells[row][col];
+			next_col = ddram_col + 1;
+			budget = budget - cost;
+		}
+	}
+
+	return needed;
+}
+
+// Returns the number of commands needed to write a page after the LCD has been cleared
+static uint32_t LCD_Page_Cache_Count_After_Clear(char cells[LCD_PAGE_CACHE_ROWS][LCD_PAGE_CACHE_COLUMNS])
+{
+	// One Clear Display command
+	uint32_t needed = 1;
+
+	for (uint8_t row = 0; row < LCD_PAGE_CACHE_ROWS; row++)
+	{
+		uint8_t next_col = 0xFF;
+
+		for (uint8_t col = 0; col < LCD_PAGE_CACHE_COLUMNS; col++)
+		{
+			if (cells[row][col] == ' ') continue;
+
+			needed = needed + ((next_col != col) ? 2 : 1);
+			next_col = col + 1;
+		}
+	}
+
+	return needed;
+}
+
+// Makes a slot visible by removing or applying the display shift
+static void LCD_Page_Cache_Shift_To(uint8_t slot)
+{
+	if (slot == 0)
+	{
+		// The Return Home command removes the display shift with a single command
+		LCD_Page_Cache_Send_Command(RETURN_HOME);
+	}
+	else
+	{
+		for (uint8_t i = 0; i < LCD_PAGE_CACHE_COLUMNS; i++)
+		{
+			LCD_Page_Cache_Send_Command(CURSOR_OR_DISPLAY_SHIFT | DISPLAY_MOVE | MOVE_LEFT);
+		}
+	}
+
+	visible_slot = slot;
+}
+
+void LCD_Page_Cache_Init(void)
+{
+	transfer_count = 0;
+	LCD_Page_Cache_Clear();
+}
+
+void LCD_Page_Cache_Show(const uint8_t* page)
+{
+	char cells[LCD_PAGE_CACHE_ROWS][LCD_PAGE_CACHE_COLUMNS];
+
+	if (!ddram_valid)
+	{
+		LCD_Page_Cache_Clear();
+	}
+
+	if (slot_pages[visible_slot] == page) return;
+
+	uint8_t hidden_slot = visible_slot ^ 0x01;
+
+	LCD_Page_Cache_Decode(page, cells);
+
+	uint32_t write_cost = LCD_Page_Cache_Write_Slot(visible_slot, cells, 0);
+
+	if (slot_pages[hidden_slot] == page)
+	{
+		uint32_t shift_cost = (hidden_slot == 0) ? 1 : LCD_PAGE_CACHE_COLUMNS;
+
+		if (shift_cost <= write_cost)
+		{
+			LCD_Page_Cache_Shift_To(hidden_slot);
+			return;
+		}
+	}
+
+	// Clearing the LCD is cheaper when most of the visible cells have to be blanked
+	// It also discards the hidden slot and returns to Slot 0
+	if (LCD_Page_Cache_Count_After_Clear(cells) < write_cost)
+	{
+		LCD_Page_Cache_Clear();
+		hidden_slot = 1;
+	}
+
+	LCD_Page_Cache_Write_Slot(visible_slot, cells, UNLIMITED_BUDGET);
+	slot_pages[visible_slot] = page;
+
+	// The hidden slot may have held the same page
+	if (slot_pages[hidden_slot] == page)
+	{
+		slot_pages[hidden_slot] = 0;
+	}
+}
+
+uint8_t LCD_Page_Cache_Prefetch(const uint8_t* page)
+{
+	char cells[LCD_PAGE_CACHE_ROWS][LCD_PAGE_CACHE_COLUMNS];
+
+	if (!ddram_valid)
+	{
+		LCD_Page_Cache_Clear();
+	}
+
+	uint8_t hidden_slot = visible_slot ^ 0x01;
+
+	if (slot_pages[hidden_slot] == page) return 1;
+
+	// There is no need to pre-render the page that is already visible
+	if (slot_pages[visible_slot] == page) return 1;
+
+	// The hidden slot no longer holds a complete page while it is being overwritten
+	slot_pages[hidden_slot] = 0;
+
+	LCD_Page_Cache_Decode(page, cells);
+
+	if (LCD_Page_Cache_Write_Slot(hidden_slot, cells, LCD_PAGE_CACHE_PREFETCH_BUDGET) != 0) return 0;
+
+	slot_pages[hidden_slot] = page;
+	return 1;
+}
+
+void LCD_Page_Cache_Invalidate(void)
+{
+	ddram_valid = 0;
+}
+
+uint32_t LCD_Page_Cache_Get_Transfer_Count(void)
+{
+	return transfer_count;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file LCD_Page_Cache.h
+ *
+ * @brief Header file for the LCD_Page_Cache driver.
+ *
+ * This file contains the function definitions for the LCD_Page_Cache driver.
+ * It uses the off-screen Display Data RAM (DDRAM) of the EduBase Board 16x2 Liquid Crystal Display (LCD)
+ * to hold a second page, so that switching to that page only requires a few commands.
+ *
+ * The HD44780 stores 40 characters per row, but only 16 of them are visible. The DDRAM is divided into two slots:
+ *  - Slot 0 (Columns 0 - 15), which is visible after a Return Home command
+ *  - Slot 1 (Columns 16 - 31), which is visible after shifting the display to the left 16 times
+ *
+ * A page is a precompiled screen stream (see LCD_Screens.def). The next page is pre-rendered into the
+ * hidden slot with LCD_Page_Cache_Prefetch during idle time, a few cells per call. When a page is shown,
+ * the driver compares the number of commands needed to shift to the slot that already holds the page,
+ * to overwrite the changed cells of the visible slot, or to clear the LCD and write the page, and uses the cheapest option.
+ * A copy of the DDRAM is kept so that only the cells that differ are ever written.
+ *
+ * @note LCD_Page_Cache_Invalidate must be called after the LCD has been written without this driver
+ * (e.g. with EduBase_LCD_Send_Stream or EduBase_LCD_Clear_Display).
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+#define LCD_PAGE_CACHE_COLUMNS          16
+#define LCD_PAGE_CACHE_ROWS             2
+#define LCD_PAGE_CACHE_SLOTS            2
+
+// Number of columns in each row of the DDRAM
+#define LCD_PAGE_CACHE_DDRAM_COLUMNS    40
+
+// Maximum number of commands sent by each call to LCD_Page_Cache_Prefetch
+#define LCD_PAGE_CACHE_PREFETCH_BUDGET  4
+
+/**
+ * @brief Initializes the page cache and clears the LCD.
+ *
+ * The LCD must be initialized with EduBase_LCD_Init before calling this function.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void LCD_Page_Cache_Init(void);
+
+/**
+ * @brief Shows a page on the LCD with the fewest number of commands.
+ *
+ * If the hidden slot already holds the page and shifting the display is cheaper, the display is shifted
+ * to the hidden slot. Otherwise, only the cells of the visible slot that differ from the page are written,
+ * unless clearing the LCD first requires fewer commands.
+ *
+ * @param page A pointer to the precompiled screen stream of the page.
+ *
+ * @return None
+ */
+void LCD_Page_Cache_Show(const uint8_t* page);
+
+/**
+ * @brief Pre-renders a page into the hidden slot.
+ *
+ * At most LCD_PAGE_CACHE_PREFETCH_BUDGET commands are sent per call, so this function can be called
+ * repeatedly from the main loop while there is nothing else to do.
+ *
+ * @param page A pointer to the precompiled screen stream of the page.
+ *
+ * @return Returns 1 if the page is completely stored in the hidden slot. Otherwise, it returns 0.
+ */
+uint8_t LCD_Page_Cache_Prefetch(const uint8_t* page);
+
+/**
+ * @brief Discards the copy of the DDRAM after the LCD has been written by another driver.
+ *
+ * The LCD is cleared before the next page is shown or pre-rendered.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void LCD_Page_Cache_Invalidate(void);
+
+/**
+ * @brief Returns the number of commands and data bytes sent to the LCD since initialization.
+ *
+ * @param None
+ *
+ * @return The number of bytes transmitted to the LCD.
+ */
+uint32_t LCD_Page_Cache_Get_Transfer_Count(void);
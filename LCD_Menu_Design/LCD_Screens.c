@@ -0,0 +1,70 @@
+/**
+ * @file LCD_Screens.c
+ *
+ * @brief Source code for the precompiled LCD screens.
+ *
+ * This file contains the precompiled command streams for the static screens
+ * of the EduBase Board 16x2 Liquid Crystal Display (LCD). Each stream can be sent
+ * with a single call to EduBase_LCD_Send_Stream.
+ *
+ * @note This file is generated by Tools/generate_lcd_screens.py from LCD_Screens.def.
+ * Do not edit it manually.
+ */
+
+#include "LCD_Screens.h"
+
+const uint8_t LCD_SCREEN_MAIN_MENU_TURN_OFF_LEDS[20] =
+{
+	0x01, 0x01, // Clear Display
+	0x01, 0x80, // Set DDRAM Address
+	0x02, 0x0D, 0x54, 0x55, 0x52, 0x4E, 0x20, 0x4F, 0x46, 0x46, 0x20, 0x4C, 0x45, 0x44, 0x53, // TURN OFF LEDS
+	0x00 // End
+};
+
+const uint8_t LCD_SCREEN_MAIN_MENU_TURN_ON_LEDS[19] =
+{
+	0x01, 0x01, // Clear Display
+	0x01, 0xC0, // Set DDRAM Address
+	0x02, 0x0C, 0x54, 0x55, 0x52, 0x4E, 0x20, 0x4F, 0x4E, 0x20, 0x4C, 0x45, 0x44, 0x53, // TURN ON LEDS
+	0x00 // End
+};
+
+const uint8_t LCD_SCREEN_MAIN_MENU_FLASH_LEDS[17] =
+{
+	0x01, 0x01, // Clear Display
+	0x01, 0x80, // Set DDRAM Address
+	0x02, 0x0A, 0x46, 0x4C, 0x41, 0x53, 0x48, 0x20, 0x4C, 0x45, 0x44, 0x53, // FLASH LEDS
+	0x00 // End
+};
+
+const uint8_t LCD_SCREEN_MAIN_MENU_HEART_SEQUENCE[21] =
+{
+	0x01, 0x01, // Clear Display
+	0x01, 0xC0, // Set DDRAM Address
+	0x02, 0x0E, 0x48, 0x45, 0x41, 0x52, 0x54, 0x20, 0x53, 0x45, 0x51, 0x55, 0x45, 0x4E, 0x43, 0x45, // HEART SEQUENCE
+	0x00 // End
+};
+
+const uint8_t LCD_SCREEN_MAIN_MENU_DISPLAY_INFO[19] =
+{
+	0x01, 0x01, // Clear Display
+	0x01, 0x80, // Set DDRAM Address
+	0x02, 0x0C, 0x44, 0x49, 0x53, 0x50, 0x4C, 0x41, 0x59, 0x20, 0x49, 0x4E, 0x46, 0x4F, // DISPLAY INFO
+	0x00 // End
+};
+
+const uint8_t LCD_SCREEN_HEART[8] =
+{
+	0x01, 0x01, // Clear Display
+	0x01, 0xC0, // Set DDRAM Address
+	0x02, 0x01, 0x04, // \x04
+	0x00 // End
+};
+
+const uint8_t LCD_SCREEN_INFO[29] =
+{
+	0x01, 0x01, // Clear Display
+	0x01, 0xC0, // Set DDRAM Address
+	0x02, 0x16, 0x45, 0x43, 0x45, 0x20, 0x34, 0x32, 0x35, 0x20, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, // ECE 425 Microprocessor
+	0x00 // End
+};
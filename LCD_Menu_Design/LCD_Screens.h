@@ -0,0 +1,22 @@
+/**
+ * @file LCD_Screens.h
+ *
+ * @brief Header file for the precompiled LCD screens.
+ *
+ * This file contains the precompiled command streams for the static screens
+ * of the EduBase Board 16x2 Liquid Crystal Display (LCD). Each stream can be sent
+ * with a single call to EduBase_LCD_Send_Stream.
+ *
+ * @note This file is generated by Tools/generate_lcd_screens.py from LCD_Screens.def.
+ * Do not edit it manually.
+ */
+
+#include "TM4C123GH6PM.h"
+
+extern const uint8_t LCD_SCREEN_MAIN_MENU_TURN_OFF_LEDS[20];
+extern const uint8_t LCD_SCREEN_MAIN_MENU_TURN_ON_LEDS[19];
+extern const uint8_t LCD_SCREEN_MAIN_MENU_FLASH_LEDS[17];
+extern const uint8_t LCD_SCREEN_MAIN_MENU_HEART_SEQUENCE[21];
+extern const uint8_t LCD_SCREEN_MAIN_MENU_DISPLAY_INFO[19];
+extern const uint8_t LCD_SCREEN_HEART[8];
+extern const uint8_t LCD_SCREEN_INFO[29];
@@ -0,0 +1,329 @@
+/**
+ * @file Motor_Control.c
+ *
+ * @brief Source code for the Motor_Control driver.
+ *
+ * This file contains the function definitions for the Motor_Control driver.
+ * It regulates the speed of a DC motor with a closed control loop that runs at a fixed rate.
+ * The following peripherals are used:
+ *  - Timer 2A:        Periodic interrupt that executes the control loop
+ *  - Wide Timer 5A:   Edge-time capture of the speed sensor (encoder channel or tachometer) on PD6 (WT5CCP0)
+ *  - PWM Module 0 Generator 0 with the dead-band generator:
+ *      - High-side output (PB6, M0PWM0)
+ *      - Complementary low-side output (PB7, M0PWM1)
+ *
+ * Each iteration of the control loop measures the speed from the period between the last two
+ * captured rising edges, runs a fixed-point (Q16.16) PID controller with feed-forward and anti-windup,
+ * and writes the new duty cycle with a globally synchronized PWM update. The number of CPU cycles
+ * spent in each iteration is measured with the DWT cycle counter.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz and that the
+ * PWM_Clock_Init function has been called before calling the Motor_Control_Init function.
+ *
+ * @note PB7 is also used by the Seven-Segment Display (SSI2 TX), so both drivers cannot be used at the same time.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Motor_Control.h"
+#include "PWM0_0.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
+
+#define SYSTEM_CLOCK_HZ     50000000UL
+
+// Controller gains (Q16.16)
+static int32_t motor_kp = 0;
+static int32_t motor_ki = 0;
+static int32_t motor_kd = 0;
+static int32_t motor_kff = 0;
+
+static volatile int32_t motor_target_rpm = 0;
+static int32_t motor_speed_rpm = 0;
+static int32_t motor_last_speed_rpm = 0;
+
+// Integral term in PWM clock ticks (Q16.16)
+static int64_t motor_integral = 0;
+
+// Duty cycle limits in PWM clock ticks
+static uint16_t motor_duty_min = 1;
+static uint16_t motor_duty_max = 1;
+static uint16_t motor_duty_cycle = 1;
+
+// Numerator used to convert the captured period (in system clock ticks) to RPM
+static uint32_t motor_rpm_numerator = 0;
+
+// Period between the last two captured edges and the number of captured edges
+static volatile uint32_t capture_period_ticks = 0;
+static volatile uint32_t capture_count = 0;
+static uint32_t last_capture_time = 0;
+static uint8_t last_capture_valid = 0;
+
+static uint32_t loop_last_capture_count = 0;
+static uint32_t loop_iterations_without_edge = MOTOR_CONTROL_STALL_ITERATIONS;
+
+static uint32_t motor_last_cycles = 0;
+static uint32_t motor_max_cycles = 0;
+
+void Motor_Control_Init(uint16_t pwm_period, uint16_t dead_band_ticks, uint32_t loop_rate_hz, uint16_t pulses_per_revolution)
+{
+	if (pwm_period < 3 || loop_rate_hz == 0 || pulses_per_revolution == 0) return;
+
+	motor_duty_min = 1;
+	motor_duty_max = pwm_period - 1;
+	motor_duty_cycle = motor_duty_min;
+
+	// (60 s/min * 50 MHz) / pulses per revolution fits in 32 bits
+	motor_rpm_numerator = (60UL * SYSTEM_CLOCK_HZ) / pulses_per_revolution;
+
+	// Initialize PWM Module 0 Generator 0 on PB6 with the minimum duty cycle
+	PWM0_0_Init(pwm_period, motor_duty_min);
+
+	// Disable the PWM0_0 block while the dead-band generator is configured
+	PWM0->_0_CTL &= ~0x01;
+
+	// Configure the PB7 pin to use the alternate function (M0PWM1)
+	// by setting Bit 7 in the AFSEL register and writing 0x4 to the PMC7 field (Bits 31 to 28) in the PCTL register
+	GPIO_PORT_B->AFSEL |= 0x80;
+	GPIO_PORT_B->PCTL &= ~0xF0000000;
+	GPIO_PORT_B->PCTL |= 0x40000000;
+	GPIO_PORT_B->DEN |= 0x80;
+
+	// Use globally synchronized updates for the comparator A (CMPAUPD, Bit 4) and
+	// generator A and B (GENAUPD, Bits 7 to 6 and GENBUPD, Bits 9 to 8) registers
+	// The new values take effect when the counter reaches zero after a GLOBALSYNC0 request
+	PWM0->_0_CTL = (PWM0->_0_CTL & ~0x03D0) | 0x0010 | 0x00C0 | 0x0300;
+
+	// Set the rising and falling edge delays of the dead-band generator
+	PWM0->_0_DBRISE = dead_band_ticks;
+	PWM0->_0_DBFALL = dead_band_ticks;
+
+	// Enable the dead-band generator by setting the ENABLE bit (Bit 0) in the PWM0DBCTL register
+	// M0PWM0 outputs pwmA delayed on its rising edge and M0PWM1 outputs the inverse of pwmA delayed on its rising edge
+	PWM0->_0_DBCTL |= 0x01;
+
+	// Enable the PWM0_0 block and pass the complementary signal to the PB7 pin (M0PWM1)
+	PWM0->_0_CTL |= 0x01;
+	PWM0->ENABLE |= 0x02;
+
+	// Enable the DWT cycle counter used to measure the cost of each iteration
+	// by setting the TRCENA bit (Bit 24) in the DEMCR register and the CYCCNTENA bit (Bit 0) in the DWT CTRL register
+	CoreDebug->DEMCR |= (1UL << 24);
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= 0x01;
+
+	// Enable the clock to Wide Timer 5 and Port D
+	Clock_Manager_Acquire(CLOCK_WIDE_TIMER, 5);
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_D);
+
+	// Configure the PD6 pin to operate as a Wide Timer 5 Capture/Compare pin (WT5CCP0)
+	// by writing 0x7 to the PMC6 field (Bits 27 to 24) in the PCTL register
+	GPIO_PORT_D->DIR &= ~0x40;
+	GPIO_PORT_D->AFSEL |= 0x40;
+	GPIO_PORT_D->PCTL &= ~0x0F000000;
+	GPIO_PORT_D->PCTL |= 0x07000000;
+	GPIO_PORT_D->DEN |= 0x40;
+
+	// Disable Wide Timer 5A during configuration
+	WTIMER5->CTL &= ~0x01;
+
+	// Select the 32-bit timer configuration (individual A and B timers) for the wide timer
+	WTIMER5->CFG = 0x04;
+
+	// Select the Capture Mode (TAMR = 0x3) with Edge-Time Mode (TACMR, Bit 2)
+	WTIMER5->TAMR = 0x07;
+
+	// Capture rising edges by clearing the TAEVENT field (Bits 3 to 2) in the GPTMCTL register
+	WTIMER5->CTL &= ~0x0C;
+
+	// Count down from the full 32-bit range
+	WTIMER5->TAILR = 0xFFFFFFFF;
+
+	// Clear and enable the capture mode event interrupt (CAEIM, Bit 2)
+	WTIMER5->ICR = 0x04;
+	WTIMER5->IMR |= 0x04;
+
+	// Set the priority level to 2 for the Wide Timer 5A interrupt (IRQ 104)
+	NVIC_SetPriority(WTIMER5A_IRQn, 2);
+
+	// Enable IRQ 104 for Wide Timer 5A by setting Bit 8 in the ISER[3] register
+	NVIC->ISER[3] |= (1 << 8);
+
+	WTIMER5->CTL |= 0x01;
+
+	// Enable the clock to Timer 2 and disable Timer 2A during configuration
+	Clock_Manager_Acquire(CLOCK_TIMER, 2);
+	TIMER2->CTL &= ~0x01;
+
+	// Select the 32-bit timer configuration and the Periodic Timer Mode
+	TIMER2->CFG = 0x00;
+	TIMER2->TAMR = 0x02;
+
+	// Set the interval of the control loop using the 50 MHz system clock
+	TIMER2->TAILR = (SYSTEM_CLOCK_HZ / loop_rate_hz) - 1;
+
+	// Clear and enable the time-out interrupt (TATOIM, Bit 0)
+	TIMER2->ICR = 0x01;
+	TIMER2->IMR |= 0x01;
+
+	// Set the priority level to 0 for the Timer 2A interrupt (IRQ 23) so that the control loop runs at a fixed rate
+	NVIC_SetPriority(TIMER2A_IRQn, 0);
+
+	// Enable IRQ 23 for Timer 2A by setting Bit 23 in the ISER[0] register
+	NVIC->ISER[0] |= (1 << 23);
+
+	TIMER2->CTL |= 0x01;
+}
+
+void Motor_Control_Set_Gains(int32_t kp, int32_t ki, int32_t kd, int32_t kff)
+{
+	// Prevent the control loop from using a partially updated set of gains
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	motor_kp = kp;
+	motor_ki = ki;
+	motor_kd = kd;
+	motor_kff = kff;
+
+	__set_PRIMASK(primask);
+}
+
+void Motor_Control_Set_Target(int32_t target_rpm)
+{
+	motor_target_rpm = target_rpm;
+}
+
+int32_t Motor_Control_Get_Speed(void)
+{
+	return motor_speed_rpm;
+}
+
+uint16_t Motor_Control_Get_Duty_Cycle(void)
+{
+	return motor_duty_cycle;
+}
+
+uint32_t Motor_Control_Get_Last_Cycles(void)
+{
+	return motor_last_cycles;
+}
+
+uint32_t Motor_Control_Get_Max_Cycles(void)
+{
+	return motor_max_cycles;
+}
+
+void TIMER2A_Handler(void)
+{
+	// Read the Timer 2A time-out interrupt flag
+	if (TIMER2->MIS & 0x01)
+	{
+		uint32_t start_cycles = DWT->CYCCNT;
+
+		// Acknowledge the Timer 2A interrupt and clear it
+		TIMER2->ICR = 0x01;
+
+		// Measure the speed from the period between the last two captured edges
+		// The motor is considered stopped if no edge has been captured for several iterations
+		uint32_t edges = capture_count;
+		if (edges != loop_last_capture_count)
+		{
+			loop_last_capture_count = edges;
+			loop_iterations_without_edge = 0;
+		}
+		else if (loop_iterations_without_edge < MOTOR_CONTROL_STALL_ITERATIONS)
+		{
+			loop_iterations_without_edge = loop_iterations_without_edge + 1;
+		}
+
+		uint32_t period_ticks = capture_period_ticks;
+		if (loop_iterations_without_edge >= MOTOR_CONTROL_STALL_ITERATIONS || period_ticks == 0)
+		{
+			motor_speed_rpm = 0;
+		}
+		else
+		{
+			motor_speed_rpm = (int32_t)(motor_rpm_numerator / period_ticks);
+		}
+
+		int32_t target_rpm = motor_target_rpm;
+		int32_t error = target_rpm - motor_speed_rpm;
+
+		// Feed-forward and proportional terms
+		int64_t output = ((int64_t)motor_kff * target_rpm) + ((int64_t)motor_kp * error);
+
+		// The derivative term acts on the measured speed to avoid a kick when the target changes
+		output = output - ((int64_t)motor_kd * (motor_speed_rpm - motor_last_speed_rpm));
+		motor_last_speed_rpm = motor_speed_rpm;
+
+		// Integrate the error unless the output is already saturated in the same direction (anti-windup)
+		int64_t output_min = (int64_t)motor_duty_min << 16;
+		int64_t output_max = (int64_t)motor_duty_max << 16;
+		int64_t integral_step = (int64_t)motor_ki * error;
+		int64_t unclamped_output = output + motor_integral;
+
+		if (!((unclamped_output >= output_max && integral_step > 0) || (unclamped_output <= output_min && integral_step < 0)))
+		{
+			motor_integral = motor_integral + integral_step;
+		}
+
+		// Limit the integral term to the output range
+		if (motor_integral > output_max)
+		{
+			motor_integral = output_max;
+		}
+		else if (motor_integral < -output_max)
+		{
+			motor_integral = -output_max;
+		}
+
+		output = output + motor_integral;
+
+		if (output > output_max)
+		{
+			output = output_max;
+		}
+		else if (output < output_min)
+		{
+			output = output_min;
+		}
+
+		motor_duty_cycle = (uint16_t)(output >> 16);
+
+		// Write the new duty cycle and request a synchronized update by setting
+		// the GLOBALSYNC0 bit (Bit 0) in the PWMCTL register. The new value takes effect
+		// at the end of the current PWM period on both complementary outputs
+		PWM0_0_Update_Duty_Cycle(motor_duty_cycle);
+		PWM0->CTL |= 0x01;
+
+		// Record the cost of this iteration
+		motor_last_cycles = DWT->CYCCNT - start_cycles;
+		if (motor_last_cycles > motor_max_cycles)
+		{
+			motor_max_cycles = motor_last_cycles;
+		}
+	}
+}
+
+void WTIMER5A_Handler(void)
+{
+	// Read the Wide Timer 5A capture mode event interrupt flag
+	if (WTIMER5->MIS & 0x04)
+	{
+		// Acknowledge the Wide Timer 5A interrupt and clear it
+		WTIMER5->ICR = 0x04;
+
+		// The timer counts down, so the period is the previous capture minus the current capture
+		uint32_t capture_time = WTIMER5->TAR;
+
+		if (last_capture_valid)
+		{
+			capture_period_ticks = last_capture_time - capture_time;
+			capture_count = capture_count + 1;
+		}
+
+		last_capture_time = capture_time;
+		last_capture_valid = 1;
+	}
+}
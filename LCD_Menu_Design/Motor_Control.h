@@ -0,0 +1,141 @@
+/**
+ * @file Motor_Control.h
+ *
+ * @brief Header file for the Motor_Control driver.
+ *
+ * This file contains the function definitions for the Motor_Control driver.
+ * It regulates the speed of a DC motor with a closed control loop that runs at a fixed rate.
+ * The following peripherals are used:
+ *  - Timer 2A:        Periodic interrupt that executes the control loop
+ *  - Wide Timer 5A:   Edge-time capture of the speed sensor (encoder channel or tachometer) on PD6 (WT5CCP0)
+ *  - PWM Module 0 Generator 0 with the dead-band generator:
+ *      - High-side output (PB6, M0PWM0)
+ *      - Complementary low-side output (PB7, M0PWM1)
+ *
+ * Each iteration of the control loop measures the speed from the period between the last two
+ * captured rising edges, runs a fixed-point (Q16.16) PID controller with feed-forward and anti-windup,
+ * and writes the new duty cycle with a globally synchronized PWM update. The number of CPU cycles
+ * spent in each iteration is measured with the DWT cycle counter.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz and that the
+ * PWM_Clock_Init function has been called before calling the Motor_Control_Init function.
+ *
+ * @note PB7 is also used by the Seven-Segment Display (SSI2 TX), so both drivers cannot be used at the same time.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+// Number of control loop iterations without a captured edge after which the motor is considered stopped
+#define MOTOR_CONTROL_STALL_ITERATIONS  50
+
+// Converts a real-valued gain to the Q16.16 format used by the controller
+#define MOTOR_CONTROL_Q16(value)        ((int32_t)((value) * 65536.0))
+
+/**
+ * @brief Initializes the PWM outputs, the speed capture input and the control loop timer.
+ *
+ * This function initializes PWM Module 0 Generator 0 with the dead-band generator enabled so that PB6 and PB7
+ * output complementary signals for an H-bridge leg. Comparator and generator updates are globally synchronized
+ * so that a new duty cycle only takes effect at the end of a PWM period. Wide Timer 5A is configured to
+ * capture the rising edges on PD6, and Timer 2A is configured to execute the control loop at the specified rate.
+ * The control loop starts with a target speed of zero.
+ *
+ * @param pwm_period The period constant of the PWM signal in PWM clock ticks.
+ *
+ * @param dead_band_ticks The delay in PWM clock ticks inserted on the rising edge of each complementary output.
+ *
+ * @param loop_rate_hz The rate at which the control loop is executed (e.g. 1000 Hz).
+ *
+ * @param pulses_per_revolution The number of rising edges on PD6 per revolution of the motor shaft.
+ *
+ * @return None
+ */
+void Motor_Control_Init(uint16_t pwm_period, uint16_t dead_band_ticks, uint32_t loop_rate_hz, uint16_t pulses_per_revolution);
+
+/**
+ * @brief Sets the gains of the controller.
+ *
+ * The gains are given in Q16.16 format (see MOTOR_CONTROL_Q16). The output of the controller is expressed
+ * in PWM clock ticks and the error in revolutions per minute (RPM).
+ *
+ * @param kp The proportional gain.
+ *
+ * @param ki The integral gain (per iteration of the control loop).
+ *
+ * @param kd The derivative gain (per iteration of the control loop).
+ *
+ * @param kff The feed-forward gain applied to the target speed.
+ *
+ * @return None
+ */
+void Motor_Control_Set_Gains(int32_t kp, int32_t ki, int32_t kd, int32_t kff);
+
+/**
+ * @brief Sets the target speed of the motor.
+ *
+ * @param target_rpm The target speed in revolutions per minute (RPM).
+ *
+ * @return None
+ */
+void Motor_Control_Set_Target(int32_t target_rpm);
+
+/**
+ * @brief Returns the speed measured during the last iteration of the control loop.
+ *
+ * @param None
+ *
+ * @return The measured speed in revolutions per minute (RPM).
+ */
+int32_t Motor_Control_Get_Speed(void);
+
+/**
+ * @brief Returns the duty cycle written during the last iteration of the control loop.
+ *
+ * @param None
+ *
+ * @return The duty cycle in PWM clock ticks.
+ */
+uint16_t Motor_Control_Get_Duty_Cycle(void);
+
+/**
+ * @brief Returns the number of CPU cycles spent in the last iteration of the control loop.
+ *
+ * @param None
+ *
+ * @return The number of CPU cycles.
+ */
+uint32_t Motor_Control_Get_Last_Cycles(void);
+
+/**
+ * @brief Returns the largest number of CPU cycles spent in one iteration of the control loop.
+ *
+ * @param None
+ *
+ * @return The number of CPU cycles.
+ */
+uint32_t Motor_Control_Get_Max_Cycles(void);
+
+/**
+ * @brief The interrupt service routine (ISR) for Timer 2A.
+ *
+ * This function executes one iteration of the control loop.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void TIMER2A_Handler(void);
+
+/**
+ * @brief The interrupt service routine (ISR) for Wide Timer 5A.
+ *
+ * This function reads the captured time of the rising edge on PD6 and stores
+ * the period between the last two edges.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void WTIMER5A_Handler(void);
@@ -0,0 +1,218 @@
+/**
+ * @file Multi_Encoder.c
+ *
+ * @brief Source code for the Multi_Encoder driver.
+ *
+ * This file contains the function definitions for the Multi_Encoder driver.
+ * It decodes up to four rotary encoders that are connected to the same GPIO port.
+ *
+ * The port is read once per sample and every encoder is decoded at the same time with bitwise operations,
+ * where each encoder occupies one bit (lane) of the A pin mask. The B pin and the optional button pin
+ * of each encoder must be located at the same offset from its A pin. For example:
+ *  - PMOD ENC modules: A = Bit 0, B = Bit 1, BTN = Bit 2 (A pin mask = 0x11, B shift = 1, button shift = 2)
+ *  - Four encoders without buttons: A = Bits 0 - 3, B = Bits 4 - 7 (A pin mask = 0x0F, B shift = 4)
+ *
+ * A rotation is detected on the rising edge of the A pin, and the direction is given by the B pin,
+ * in the same way as PMOD_ENC_Get_Rotation. The decoding cost only depends on the number of encoders
+ * when an event occurs. Each encoder keeps its own position and its own queue of events.
+ *
+ * @note Multi_Encoder_Sample must be called periodically (e.g. every 1 ms from the Timer 0A periodic task).
+ *
+ * @note The pins PD7 and PF0 are locked and cannot be used without unlocking them first.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Multi_Encoder.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
+
+typedef struct
+{
+	uint8_t events[MULTI_ENCODER_QUEUE_SIZE];
+	volatile uint8_t head;
+	volatile uint8_t tail;
+	volatile int32_t position;
+	uint32_t dropped_count;
+} Multi_Encoder_State;
+
+static GPIOA_Type* encoder_port = 0;
+
+static uint32_t a_pin_mask = 0;
+static uint8_t b_pin_shift = 0;
+static uint8_t button_pin_shift = 0;
+
+// State of the A pins and the button pins in the previous sample (one bit per lane)
+static uint32_t last_a_pins = 0;
+static uint32_t last_buttons = 0;
+
+// Index of the encoder assigned to each bit of the port
+static uint8_t lane_encoders[8];
+
+static Multi_Encoder_State encoders[MULTI_ENCODER_MAX_ENCODERS];
+static uint8_t encoder_count = 0;
+
+static uint8_t Multi_Encoder_Get_Port_Clock(GPIOA_Type* port)
+{
+	if (port == GPIO_PORT_A) return CLOCK_GPIO_PORT_A;
+	if (port == GPIO_PORT_B) return CLOCK_GPIO_PORT_B;
+	if (port == GPIO_PORT_C) return CLOCK_GPIO_PORT_C;
+	if (port == GPIO_PORT_D) return CLOCK_GPIO_PORT_D;
+	if (port == GPIO_PORT_E) return CLOCK_GPIO_PORT_E;
+	return CLOCK_GPIO_PORT_F;
+}
+
+// Adds an event to the queue of every encoder whose lane is set in the mask
+static void Multi_Encoder_Add_Events(uint32_t lanes, uint8_t event)
+{
+	while (lanes != 0)
+	{
+		// Find the index of the lowest lane and clear it
+		uint8_t lane = (uint8_t)__CLZ(__RBIT(lanes));
+		lanes &= lanes - 1;
+
+		Multi_Encoder_State* encoder = &encoders[lane_encoders[lane]];
+
+		if (event == MULTI_ENCODER_CLOCKWISE)
+		{
+			encoder->position = encoder->position + 1;
+		}
+		else if (event == MULTI_ENCODER_COUNTER_CLOCKWISE)
+		{
+			encoder->position = encoder->position - 1;
+		}
+
+		uint8_t next_head = (encoder->head + 1) & (MULTI_ENCODER_QUEUE_SIZE - 1);
+
+		if (next_head == encoder->tail)
+		{
+			encoder->dropped_count = encoder->dropped_count + 1;
+		}
+		else
+		{
+			encoder->events[encoder->head] = event;
+			encoder->head = next_head;
+		}
+	}
+}
+
+uint8_t Multi_Encoder_Init(GPIOA_Type* port, uint8_t a_pins, uint8_t b_shift, uint8_t button_shift)
+{
+	encoder_port = port;
+	b_pin_shift = b_shift;
+	button_pin_shift = button_shift;
+	a_pin_mask = 0;
+	encoder_count = 0;
+
+	// Assign an encoder to each of the lowest A pins
+	for (uint8_t lane = 0; lane < 8 && encoder_count < MULTI_ENCODER_MAX_ENCODERS; lane++)
+	{
+		if (a_pins & (1 << lane))
+		{
+			a_pin_mask |= (1 << lane);
+			lane_encoders[lane] = encoder_count;
+
+			encoders[encoder_count].head = 0;
+			encoders[encoder_count].tail = 0;
+			encoders[encoder_count].position = 0;
+			encoders[encoder_count].dropped_count = 0;
+
+			encoder_count = encoder_count + 1;
+		}
+	}
+
+	uint8_t pin_mask = (uint8_t)(a_pin_mask | (a_pin_mask << b_pin_shift));
+
+	if (button_pin_shift != 0)
+	{
+		pin_mask |= (uint8_t)(a_pin_mask << button_pin_shift);
+	}
+
+	// Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
+	// Enable the clock to the GPIO port and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, Multi_Encoder_Get_Port_Clock(port));
+
+	// Configure the encoder pins as input by clearing the corresponding bits in the DIR register
+	port->DIR &= ~pin_mask;
+
+	// Configure the encoder pins to function as GPIO pins
+	// by clearing the corresponding bits in the AFSEL register
+	port->AFSEL &= ~pin_mask;
+
+	// Enable the digital functionality for the encoder pins
+	// by setting the corresponding bits in the DEN register
+	port->DEN |= pin_mask;
+
+	// Start from the current state so that no event is reported for the initial pin levels
+	uint32_t data = port->DATA;
+	last_a_pins = data & a_pin_mask;
+	last_buttons = (button_pin_shift != 0) ? ((data >> button_pin_shift) & a_pin_mask) : 0;
+
+	return encoder_count;
+}
+
+void Multi_Encoder_Sample(void)
+{
+	if (encoder_port == 0) return;
+
+	// Read every pin of the port once and align the B pins and the button pins with the A pins
+	uint32_t data = encoder_port->DATA;
+	uint32_t a_pins = data & a_pin_mask;
+	uint32_t b_pins = (data >> b_pin_shift) & a_pin_mask;
+
+	// Lanes with a rising edge on the A pin rotated clockwise if the B pin is high
+	uint32_t rising_edges = a_pins & ~last_a_pins;
+	uint32_t clockwise = rising_edges & b_pins;
+	uint32_t counter_clockwise = rising_edges & ~b_pins;
+	last_a_pins = a_pins;
+
+	uint32_t pressed = 0;
+	uint32_t released = 0;
+
+	if (button_pin_shift != 0)
+	{
+		uint32_t buttons = (data >> button_pin_shift) & a_pin_mask;
+		uint32_t changed = buttons ^ last_buttons;
+		pressed = changed & buttons;
+		released = changed & ~buttons;
+		last_buttons = buttons;
+	}
+
+	// Most samples do not contain any event
+	if ((clockwise | counter_clockwise | pressed | released) == 0) return;
+
+	Multi_Encoder_Add_Events(clockwise, MULTI_ENCODER_CLOCKWISE);
+	Multi_Encoder_Add_Events(counter_clockwise, MULTI_ENCODER_COUNTER_CLOCKWISE);
+	Multi_Encoder_Add_Events(pressed, MULTI_ENCODER_BUTTON_PRESSED);
+	Multi_Encoder_Add_Events(released, MULTI_ENCODER_BUTTON_RELEASED);
+}
+
+uint8_t Multi_Encoder_Get_Event(uint8_t encoder, uint8_t* event)
+{
+	if (encoder >= encoder_count) return 0;
+
+	Multi_Encoder_State* state = &encoders[encoder];
+
+	if (state->tail == state->head) return 0;
+
+	*event = state->events[state->tail];
+	state->tail = (state->tail + 1) & (MULTI_ENCODER_QUEUE_SIZE - 1);
+
+	return 1;
+}
+
+int32_t Multi_Encoder_Get_Position(uint8_t encoder)
+{
+	if (encoder >= encoder_count) return 0;
+
+	return encoders[encoder].position;
+}
+
+uint32_t Multi_Encoder_Get_Dropped_Count(uint8_t encoder)
+{
+	if (encoder >= encoder_count) return 0;
+
+	return encoders[encoder].dropped_count;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file Multi_Encoder.h
+ *
+ * @brief Header file for the Multi_Encoder driver.
+ *
+ * This file contains the function definitions for the Multi_Encoder driver.
+ * It decodes up to four rotary encoders that are connected to the same GPIO port.
+ *
+ * The port is read once per sample and every encoder is decoded at the same time with bitwise operations,
+ * where each encoder occupies one bit (lane) of the A pin mask. The B pin and the optional button pin
+ * of each encoder must be located at the same offset from its A pin. For example:
+ *  - PMOD ENC modules: A = Bit 0, B = Bit 1, BTN = Bit 2 (A pin mask = 0x11, B shift = 1, button shift = 2)
+ *  - Four encoders without buttons: A = Bits 0 - 3, B = Bits 4 - 7 (A pin mask = 0x0F, B shift = 4)
+ *
+ * A rotation is detected on the rising edge of the A pin, and the direction is given by the B pin,
+ * in the same way as PMOD_ENC_Get_Rotation. The decoding cost only depends on the number of encoders
+ * when an event occurs. Each encoder keeps its own position and its own queue of events.
+ *
+ * @note Multi_Encoder_Sample must be called periodically (e.g. every 1 ms from the Timer 0A periodic task).
+ *
+ * @note The pins PD7 and PF0 are locked and cannot be used without unlocking them first.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+#define MULTI_ENCODER_MAX_ENCODERS      4
+
+// Number of events that can be queued for each encoder (must be a power of two)
+#define MULTI_ENCODER_QUEUE_SIZE        8
+
+enum Multi_Encoder_Events
+{
+	MULTI_ENCODER_CLOCKWISE             = 0x01,
+	MULTI_ENCODER_COUNTER_CLOCKWISE     = 0x02,
+	MULTI_ENCODER_BUTTON_PRESSED        = 0x03,
+	MULTI_ENCODER_BUTTON_RELEASED       = 0x04
+};
+
+/**
+ * @brief Initializes the pins of the encoders connected to a GPIO port.
+ *
+ * The encoders are numbered from the least significant bit of the A pin mask. If the A pin mask
+ * contains more than MULTI_ENCODER_MAX_ENCODERS bits, only the lowest bits are used.
+ *
+ * @param port A pointer to the GPIO port (e.g. GPIO_PORT_D).
+ *
+ * @param a_pins The mask of the A pins (one bit per encoder).
+ *
+ * @param b_shift The offset of the B pin from the A pin of each encoder (1 - 7).
+ *
+ * @param button_shift The offset of the button pin from the A pin of each encoder, or 0 if there are no buttons.
+ *
+ * @return The number of encoders that will be decoded.
+ */
+uint8_t Multi_Encoder_Init(GPIOA_Type* port, uint8_t a_pins, uint8_t b_shift, uint8_t button_shift);
+
+/**
+ * @brief Reads the GPIO port once and decodes every encoder.
+ *
+ * This function can be called from an interrupt service routine.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Multi_Encoder_Sample(void);
+
+/**
+ * @brief Removes the oldest event from the queue of an encoder.
+ *
+ * @param encoder The index of the encoder.
+ *
+ * @param event A pointer to the variable that receives the event (e.g. MULTI_ENCODER_CLOCKWISE).
+ *
+ * @return Returns 1 if an event was available. Otherwise, it returns 0.
+ */
+uint8_t Multi_Encoder_Get_Event(uint8_t encoder, uint8_t* event);
+
+/**
+ * @brief Returns the position of an encoder.
+ *
+ * The position is incremented for every clockwise step and decremented for every counter-clockwise step.
+ * Unlike the event queue, the position cannot overflow when the events are not read.
+ *
+ * @param encoder The index of the encoder.
+ *
+ * @return The position of the encoder, or 0 if the encoder does not exist.
+ */
+int32_t Multi_Encoder_Get_Position(uint8_t encoder);
+
+/**
+ * @brief Returns the number of events that were dropped because the queue of an encoder was full.
+ *
+ * @param encoder The index of the encoder.
+ *
+ * @return The number of dropped events.
+ */
+uint32_t Multi_Encoder_Get_Dropped_Count(uint8_t encoder);
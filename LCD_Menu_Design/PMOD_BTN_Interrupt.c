@@ -17,63 +17,74 @@
  */
  
 #include "PMOD_BTN_Interrupt.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
+#include "Interrupt_Guard.h"
  
 // Declare pointer to the user-defined task
 void (*PMOD_BTN_Task)(uint8_t pmod_btn_state);
 
+// Executes the user-defined task while Port A is polled after an interrupt storm
+static void PMOD_BTN_Poll_Task(void)
+{
+	(*PMOD_BTN_Task)(PMOD_BTN_Read());
+}
+
 void PMOD_BTN_Interrupt_Init(void(*task)(uint8_t))
 {
 	// Store the user-defined task function for use during interrupt handling
 	PMOD_BTN_Task = task;
 	
-	// Enable the clock to Port A by setting the
-	// R0 bit (Bit 0) in the RCGCGPIO register
-	SYSCTL->RCGCGPIO |= 0x01;
+	// Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
+	// Enable the clock to Port A and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_A);
 	
 	// Configure the PA5, PA4, PA3, and PA2 pins as input
 	// by clearing Bits 5 to 2 in the DIR register
-	GPIOA->DIR &= ~0x3C;
+	GPIO_PORT_A->DIR &= ~0x3C;
 	
 	// Configure the PA5, PA4, PA3, and PA2 pins to function as
 	// GPIO pins by clearing Bits 5 to 2 in the AFSEL register
-	GPIOA->AFSEL &= ~0x3C;
+	GPIO_PORT_A->AFSEL &= ~0x3C;
 	
 	// Enable the digital functionality for the PA5, PA4, PA3, and PA2 pins
 	// by setting Bits 5 to 2 in the DEN register
-	GPIOA->DEN |= 0x3C;
+	GPIO_PORT_A->DEN |= 0x3C;
 	
 	// Enable the weak pull-down resistor for the PA5, PA4, PA3, and PA2 pins
 	// by setting Bits 5 to 2 in the PDR register
-	GPIOA->PDR |= 0x3C;
+	GPIO_PORT_A->PDR |= 0x3C;
 	
 	// Configure the PA5, PA4, PA3, and PA2 pins to detect edges
 	// by clearing Bits 5 to 2 in the IS register
-	GPIOA->IS &= ~0x3C;
+	GPIO_PORT_A->IS &= ~0x3C;
 	
 	// Allow the GPIOIEV register to handle interrupt generation
 	// and determine which edge to check for the PA5, PA4, PA3, and PA2 pins 
 	// by clearing Bits 5 to 2 in the IBE register
-	GPIOA->IBE &= ~0x3C;
+	GPIO_PORT_A->IBE &= ~0x3C;
 	
 	// Configure the PA5, PA4, PA3, and PA2 pins to detect
 	// rising edges by setting Bits 5 to 2 in the IEV register
 	// Rising edges on the corresponding pins will trigger interrupts
-	GPIOA->IEV |= 0x3C;
+	GPIO_PORT_A->IEV |= 0x3C;
+	
+	// Limit the rate of the interrupts generated by the PA5, PA4, PA3, and PA2 pins
+	Interrupt_Guard_Init(INTERRUPT_GUARD_PMOD_BTN, GPIO_PORT_A, 0x3C, &PMOD_BTN_Poll_Task);
 	
 	// Clear any existing interrupt flags on the PA5, PA4, PA3, and PA2 pins
 	// by setting Bits 5 to 2 in the ICR register
-	GPIOA->ICR |= 0x3C;
+	GPIO_PORT_A->ICR |= 0x3C;
 	
 	// Allow the interrupts that are generated by the PA5, PA4, PA3, and PA2 pins
 	// to be sent to the interrupt controller by setting
 	// Bits 5 to 2 in the IM register
-	GPIOA->IM |= 0x3C;
-	
-	// Clear the INTA field (Bits 7 to 5) of the IPR[0] register (PRI0)
-	NVIC->IPR[0] &= ~0x000000E0;
+	GPIO_PORT_A->IM |= 0x3C;
 	
 	// Set the priority level of the interrupts to 3. Port A has an Interrupt Request (IRQ) number of 0
-	NVIC->IPR[0] |= (3 << 5);
+	NVIC_SetPriority(GPIOA_IRQn, 3);
 	
 	// Enable IRQ 0 for GPIO Port A by setting Bit 0 in the ISER[0] register
 	NVIC->ISER[0] |= (1 << 0);
@@ -84,7 +95,7 @@ uint8_t PMOD_BTN_Read(void)
 	// Declare a local variable to store the status of the PMOD BTN
 	// Then, read the DATA register for Port A
 	// A "0x3C" bit mask is used to capture only the pins used the PMOD BTN
-	uint8_t pmod_btn_state = GPIOA->DATA & 0x3C;
+	uint8_t pmod_btn_state = GPIO_PORT_A->DATA & 0x3C;
 	
 	// Return the status of the PMOD BTN module
 	return pmod_btn_state;
@@ -94,13 +105,17 @@ void GPIOA_Handler(void)
 {
 	// Check if an interrupt has been triggered by any of
 	// the following pins: PA5, PA4, PA3, and PA2
-	if (GPIOA->MIS & 0x3C)
+	if (GPIO_PORT_A->MIS & 0x3C)
 	{
-		// Execute the user-defined function
-		(*PMOD_BTN_Task)(PMOD_BTN_Read());
+		// Execute the user-defined function unless the pins have been masked
+		// because they generate an interrupt storm
+		if (Interrupt_Guard_Count(INTERRUPT_GUARD_PMOD_BTN))
+		{
+			(*PMOD_BTN_Task)(PMOD_BTN_Read());
+		}
 		
 		// Acknowledge the interrupt from any of the following pins
 		// and clear it: PA5, PA4, PA3, and PA2
-		GPIOA->ICR |= 0x3C;
+		GPIO_PORT_A->ICR |= 0x3C;
 	}
 }
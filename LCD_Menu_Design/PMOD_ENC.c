@@ -24,29 +24,33 @@
  */
  
 #include "PMOD_ENC.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
 
 void PMOD_ENC_Init(void)
 {
-	//Enable the clock to Port D by setting the
-	//R3 bit (Bit 3) in the RCGCGPIO register
-	SYSCTL->RCGCGPIO |= 0x08;
+	//Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
+	//Enable the clock to Port D and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_D);
 	
 	//Configure the PD3, PD2, PD1, and PD0 pins as input
 	//by clearing Bits 3 to 0 in the DIR register
-	GPIOD->DIR &= ~PMOD_ENC_ALL_PINS_MASK;
+	GPIO_PORT_D->DIR &= ~PMOD_ENC_ALL_PINS_MASK;
 	
 	//Configure the PD3, PD2, PD1, and PD0 pins to function as
 	//GPIO pins by clearing Bits 3 to 0 in the AFSEL register
-	GPIOD->AFSEL &= ~PMOD_ENC_ALL_PINS_MASK;
+	GPIO_PORT_D->AFSEL &= ~PMOD_ENC_ALL_PINS_MASK;
 	
 	//Enable the digital functionality for the PD3, PD2, PD1, and PD0 pins
 	//by setting Bits 3 to 0 in the DEN register
-	GPIOD->DEN |= PMOD_ENC_ALL_PINS_MASK;
+	GPIO_PORT_D->DEN |= PMOD_ENC_ALL_PINS_MASK;
 } 
 
 uint8_t PMOD_ENC_Get_State(void)
 {
-	uint8_t state = GPIOD->DATA & PMOD_ENC_ALL_PINS_MASK;
+	uint8_t state = GPIO_PORT_D->DATA & PMOD_ENC_ALL_PINS_MASK;
 	return state;
 }
 
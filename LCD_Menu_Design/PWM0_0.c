@@ -15,6 +15,8 @@
  */
 
 #include "PWM0_0.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
  
 void PWM0_0_Init(uint16_t period_constant, uint16_t duty_cycle)
 {	
@@ -22,29 +24,30 @@ void PWM0_0_Init(uint16_t period_constant, uint16_t duty_cycle)
 	// or equal to the given period. The duty cycle cannot exceed 99%.
 	if (duty_cycle >= period_constant) return;
 	
-	// Enable the clock to PWM Module 0 by setting the
-	// R0 bit (Bit 0) in the RCGCPWM register
-	SYSCTL->RCGCPWM |= 0x01;
+	// Enable the clock to PWM Module 0 and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_PWM, 0);
 	
-	// Enable the clock to GPIO Port B by setting the
-	// R1 bit (Bit 1) in the RCGCGPIO register
-	SYSCTL->RCGCGPIO |= 0x02;
+	// Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
+	// Enable the clock to GPIO Port B and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_B);
 	
 	// Configure the PB6 pin to use the alternate function (M0PWM0)
 	// by setting Bit 6 in the AFSEL register
-	GPIOB->AFSEL |= 0x40;
+	GPIO_PORT_B->AFSEL |= 0x40;
 	
 	// Clear the PMC6 field (Bits 27 to 24) in the PCTL register
-	GPIOB->PCTL &= ~0x0F000000;
+	GPIO_PORT_B->PCTL &= ~0x0F000000;
 	
 	// Configure the PB6 pin to operate as a Module 0 PWM0 pin (M0PWM0)
 	// by writing 0x4 to the PMC6 field (Bits 27 to 24) in the PCTL register
 	// The 0x4 value is derived from Table 23-5 in the TM4C123G Microcontroller Datasheet
-	GPIOB->PCTL |= 0x04000000;
+	GPIO_PORT_B->PCTL |= 0x04000000;
 	
 	// Enable the digital functionality for the PB6 pin
 	// by setting Bit 6 in the DEN register
-	GPIOB->DEN |= 0x40;
+	GPIO_PORT_B->DEN |= 0x40;
 	
 	// Disable the Module 0 PWM Generator 0 block (PWM0_0) before 
 	// configuration by clearing the ENABLE bit (Bit 0) in the PWM0CTL register
@@ -15,6 +15,8 @@
  */
  
 #include "PWM1_3.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
  
 void PWM1_3_Init(uint16_t period_constant, uint16_t duty_cycle)
 {	
@@ -22,29 +24,30 @@ void PWM1_3_Init(uint16_t period_constant, uint16_t duty_cycle)
 	// or equal to the given period. The duty cycle cannot exceed 99%.
 	if (duty_cycle >= period_constant) return;
 	
-	// Enable the clock to PWM Module 1 by setting the
-	// R1 bit (Bit 1) in the RCGCPWM register
-	SYSCTL->RCGCPWM |= 0x02;
+	// Enable the clock to PWM Module 1 and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_PWM, 1);
 	
-	// Enable the clock to GPIO Port F by setting the
-	// R5 bit (Bit 5) in the RCGCGPIO register
-	SYSCTL->RCGCGPIO |= 0x20;
+	// Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
+	// Enable the clock to GPIO Port F and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_F);
 	
 	// Configure the PF2 pin to use the alternate function (M1PWM6)
 	// by setting Bit 2 in the AFSEL register
-	GPIOF->AFSEL |= 0x04;
+	GPIO_PORT_F->AFSEL |= 0x04;
 	
 	// Clear the PMC2 field (Bits 11 to 8) in the PCTL register
-	GPIOF->PCTL &= ~0x00000F00;
+	GPIO_PORT_F->PCTL &= ~0x00000F00;
 	
 	// Configure the PF2 pin to operate as a Module 1 PWM6 pin (M1PWM6)
 	// by writing 0x5 to the PMC2 field (Bits 11 to 8) in the PCTL register
 	// The 0x5 value is derived from Table 23-5 in the TM4C123G Microcontroller Datasheet
-	GPIOF->PCTL |= 0x00000500;
+	GPIO_PORT_F->PCTL |= 0x00000500;
 	
 	// Enable the digital functionality for the PF2 pin
 	// by setting Bit 2 in the DEN register
-	GPIOF->DEN |= 0x04;
+	GPIO_PORT_F->DEN |= 0x04;
 	
 	// Disable the Module 1 PWM Generator 3 block (PWM1_3) before 
 	// configuration by clearing the ENABLE bit (Bit 0) in the PWM3CTL register
@@ -0,0 +1,181 @@
+/**
+ * @file Profiler.c
+ *
+ * @brief Source code for the Profiler driver.
+ *
+ * This file contains the function definitions for the Profiler driver.
+ * It periodically samples the program counter (PC) and the link register (LR) of the code that is
+ * interrupted by Timer 3A. The samples show where the CPU spends its time without instrumenting the code.
+ *
+ * The samples are stored in the profiler_samples buffer until it is full. The buffer can then be saved
+ * from the debugger and mapped to function names with Tools/symbolize_profile.py. For example, if the map file
+ * lists profiler_samples at address 0x20000400, enter the following in the uVision command window:
+ *  SAVE profile.hex 0x20000400, 0x200013FF
+ *
+ * Timer 3A uses the highest priority level (0), while the other drivers use lower levels
+ * (Timer 0A: 1, Timer 1A, Timer 4A and Wide Timer 5A: 2, GPIO Port A and Port D: 3). The samples therefore include the
+ * interrupt service routines as well as the main loop. The following code is not sampled:
+ *  - Code executed while interrupts are disabled (e.g. critical sections); the pending sample is
+ *    attributed to the instruction that enables the interrupts again
+ *  - Interrupts with the same priority level, such as the Motor_Control Timer 2A control loop
+ * Each sample takes approximately 40 clock cycles including the exception entry and return,
+ * which corresponds to an overhead of 0.08% at the default rate of 997 Hz.
+ *
+ * @note The sampling rate is not a divisor of 1 kHz by default, so that the samples do not stay
+ * in phase with the 1 ms periodic task.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Profiler.h"
+#include "Clock_Manager.h"
+
+#define SYSTEM_CLOCK_HZ     50000000UL
+
+// Indices of the stacked LR and PC in the exception stack frame (R0 - R3, R12, LR, PC, xPSR)
+#define STACKED_LR          5
+#define STACKED_PC          6
+
+Profiler_Sample profiler_samples[PROFILER_MAX_SAMPLES];
+
+static volatile uint32_t sample_count = 0;
+static volatile uint8_t profiler_running = 0;
+
+// Called by TIMER3A_Handler with the address of the exception stack frame
+void Profiler_Record_Sample(uint32_t* stack_frame);
+
+void Profiler_Init(uint32_t sampling_rate_hz)
+{
+	if (sampling_rate_hz == 0)
+	{
+		sampling_rate_hz = 1;
+	}
+	else if (sampling_rate_hz > 50000)
+	{
+		sampling_rate_hz = 50000;
+	}
+
+	profiler_running = 0;
+	sample_count = 0;
+
+	// Enable the clock for Timer 3A and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_TIMER, 3);
+
+	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
+	// to disable Timer 3A
+	TIMER3->CTL &= ~0x01;
+
+	// Select the 32-bit timer configuration by writing 0x0 to the GPTMCFG register
+	TIMER3->CFG = 0x00;
+
+	// Select the Periodic Timer Mode by writing 0x2 to the TAMR field (Bits 1 to 0)
+	TIMER3->TAMR = 0x02;
+
+	// Set the interval between two samples
+	TIMER3->TAILR = (SYSTEM_CLOCK_HZ / sampling_rate_hz) - 1;
+
+	// Clear the time-out interrupt flag and enable the time-out interrupt
+	TIMER3->ICR = 0x01;
+	TIMER3->IMR = 0x01;
+
+	// Set the priority level to 0 (highest) for the Timer 3A interrupt (IRQ 35)
+	// All other interrupts used by the main menu have a lower priority level (1 - 3)
+	NVIC_SetPriority(TIMER3A_IRQn, 0);
+
+	// Enable IRQ 35 for Timer 3A by setting Bit 3 in the ISER[1] register
+	NVIC->ISER[1] |= (1 << 3);
+
+	// Gate the clock until the profiler is started
+	Clock_Manager_Release(CLOCK_TIMER, 3);
+}
+
+void Profiler_Start(void)
+{
+	if (profiler_running) return;
+
+	for (uint32_t i = 0; i < PROFILER_MAX_SAMPLES; i++)
+	{
+		profiler_samples[i].pc = 0;
+		profiler_samples[i].lr = 0;
+	}
+
+	sample_count = 0;
+	profiler_running = 1;
+
+	Clock_Manager_Acquire(CLOCK_TIMER, 3);
+
+	// Reload the counter and enable Timer 3A
+	TIMER3->TAV = TIMER3->TAILR;
+	TIMER3->ICR = 0x01;
+	TIMER3->CTL |= 0x01;
+}
+
+void Profiler_Stop(void)
+{
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (profiler_running)
+	{
+		// Disable Timer 3A and discard a pending time-out
+		TIMER3->CTL &= ~0x01;
+		TIMER3->ICR = 0x01;
+		profiler_running = 0;
+
+		// Clear IRQ 35 in case it was already pending, since Timer 3 cannot be accessed once its clock is gated
+		NVIC->ICPR[1] = (1 << 3);
+
+		Clock_Manager_Release(CLOCK_TIMER, 3);
+	}
+
+	__set_PRIMASK(primask);
+}
+
+uint32_t Profiler_Get_Sample_Count(void)
+{
+	return sample_count;
+}
+
+uint8_t Profiler_Is_Running(void)
+{
+	return profiler_running;
+}
+
+void Profiler_Record_Sample(uint32_t* stack_frame)
+{
+	if (!profiler_running) return;
+
+	// Acknowledge the Timer 3A time-out interrupt and clear it
+	TIMER3->ICR = 0x01;
+
+	uint32_t index = sample_count;
+
+	profiler_samples[index].pc = stack_frame[STACKED_PC];
+	profiler_samples[index].lr = stack_frame[STACKED_LR];
+	sample_count = index + 1;
+
+	if (sample_count >= PROFILER_MAX_SAMPLES)
+	{
+		Profiler_Stop();
+	}
+}
+
+/**
+ * The handler passes the address of the exception stack frame to Profiler_Record_Sample.
+ * Bit 2 of the EXC_RETURN value in LR indicates whether the interrupted code used the
+ * Main Stack Pointer (MSP) or the Process Stack Pointer (PSP). LR is not modified,
+ * so Profiler_Record_Sample returns from the exception.
+ */
+__attribute__((naked)) void TIMER3A_Handler(void)
+{
+	__asm volatile
+	(
+		"tst lr, #4                 \n"
+		"ite eq                     \n"
+		"mrseq r0, msp              \n"
+		"mrsne r0, psp              \n"
+		"b Profiler_Record_Sample   \n"
+	);
+}
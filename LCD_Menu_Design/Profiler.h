@@ -0,0 +1,99 @@
+/**
+ * @file Profiler.h
+ *
+ * @brief Header file for the Profiler driver.
+ *
+ * This file contains the function definitions for the Profiler driver.
+ * It periodically samples the program counter (PC) and the link register (LR) of the code that is
+ * interrupted by Timer 3A. The samples show where the CPU spends its time without instrumenting the code.
+ *
+ * The samples are stored in the profiler_samples buffer until it is full. The buffer can then be saved
+ * from the debugger and mapped to function names with Tools/symbolize_profile.py. For example, if the map file
+ * lists profiler_samples at address 0x20000400, enter the following in the uVision command window:
+ *  SAVE profile.hex 0x20000400, 0x200013FF
+ *
+ * Timer 3A uses the highest priority level (0), while the other drivers use lower levels
+ * (Timer 0A: 1, Timer 1A, Timer 4A and Wide Timer 5A: 2, GPIO Port A and Port D: 3). The samples therefore include the
+ * interrupt service routines as well as the main loop. The following code is not sampled:
+ *  - Code executed while interrupts are disabled (e.g. critical sections); the pending sample is
+ *    attributed to the instruction that enables the interrupts again
+ *  - Interrupts with the same priority level, such as the Motor_Control Timer 2A control loop
+ * Each sample takes approximately 40 clock cycles including the exception entry and return,
+ * which corresponds to an overhead of 0.08% at the default rate of 997 Hz.
+ *
+ * @note The sampling rate is not a divisor of 1 kHz by default, so that the samples do not stay
+ * in phase with the 1 ms periodic task.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+// Set PROFILER_ENABLE to 1 in the project options to profile the main menu
+#ifndef PROFILER_ENABLE
+#define PROFILER_ENABLE             0
+#endif
+
+#define PROFILER_DEFAULT_RATE_HZ    997
+
+// Number of samples that can be stored (8 bytes per sample)
+#define PROFILER_MAX_SAMPLES        512
+
+typedef struct
+{
+	uint32_t pc;
+	uint32_t lr;
+} Profiler_Sample;
+
+extern Profiler_Sample profiler_samples[PROFILER_MAX_SAMPLES];
+
+/**
+ * @brief Initializes Timer 3A to sample the interrupted code at the specified rate.
+ *
+ * The profiler does not start sampling until Profiler_Start is called.
+ *
+ * @param sampling_rate_hz The number of samples taken per second (1 - 50000).
+ *
+ * @return None
+ */
+void Profiler_Init(uint32_t sampling_rate_hz);
+
+/**
+ * @brief Clears the sample buffer and starts sampling.
+ *
+ * Sampling stops automatically when PROFILER_MAX_SAMPLES samples have been taken.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Profiler_Start(void);
+
+/**
+ * @brief Stops sampling and disables the clock to Timer 3.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Profiler_Stop(void);
+
+/**
+ * @brief Returns the number of samples taken since the profiler was started.
+ *
+ * @param None
+ *
+ * @return The number of valid entries in profiler_samples.
+ */
+uint32_t Profiler_Get_Sample_Count(void);
+
+/**
+ * @brief Indicates whether the profiler is sampling.
+ *
+ * @param None
+ *
+ * @return Returns 1 if the profiler is sampling. Otherwise, it returns 0.
+ */
+uint8_t Profiler_Is_Running(void);
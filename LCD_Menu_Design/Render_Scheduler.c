@@ -0,0 +1,102 @@
+/**
+ * @file Render_Scheduler.c
+ *
+ * @brief Source code for the Render_Scheduler driver.
+ *
+ * This file contains the function definitions for the Render_Scheduler driver.
+ * It limits how often the display is redrawn while always showing the latest state.
+ *
+ * Updates only mark the state as dirty with Render_Scheduler_Mark_Dirty, which can be called from an
+ * interrupt service routine. The render function is executed by Render_Scheduler_Run from the main loop,
+ * at most once per frame interval. Any number of updates that occur within the same frame interval
+ * are coalesced into a single redraw, so the time spent on the display bus per second is bounded
+ * while the latest state is shown within one frame interval.
+ *
+ * @note Render_Scheduler_Tick must be called every 1 ms (e.g. from the Timer 0A periodic task).
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Render_Scheduler.h"
+
+// Pointer to the user-defined render function
+static void (*Render_Scheduler_Render)(void);
+
+static uint32_t frame_interval_ms = 1;
+
+// Time elapsed since the last frame was rendered (saturates at frame_interval_ms)
+static volatile uint32_t ms_since_last_frame = 0;
+
+static volatile uint8_t render_dirty = 0;
+
+static uint32_t frame_count = 0;
+static volatile uint32_t update_count = 0;
+
+void Render_Scheduler_Init(void(*render)(void), uint32_t max_frame_rate)
+{
+	Render_Scheduler_Render = render;
+
+	if (max_frame_rate == 0)
+	{
+		max_frame_rate = 1;
+	}
+	else if (max_frame_rate > 1000)
+	{
+		max_frame_rate = 1000;
+	}
+
+	// Round the frame interval up so that the frame rate never exceeds max_frame_rate
+	frame_interval_ms = (1000 + max_frame_rate - 1) / max_frame_rate;
+
+	// Render the first frame without waiting for a full frame interval
+	ms_since_last_frame = frame_interval_ms;
+	render_dirty = 1;
+
+	frame_count = 0;
+	update_count = 0;
+}
+
+void Render_Scheduler_Mark_Dirty(void)
+{
+	// This function can be called from both the main loop and interrupt service routines,
+	// so the update count is incremented with interrupts disabled
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	render_dirty = 1;
+	update_count = update_count + 1;
+
+	__set_PRIMASK(primask);
+}
+
+void Render_Scheduler_Tick(void)
+{
+	if (ms_since_last_frame < frame_interval_ms)
+	{
+		ms_since_last_frame = ms_since_last_frame + 1;
+	}
+}
+
+uint8_t Render_Scheduler_Run(void)
+{
+	if (!render_dirty || ms_since_last_frame < frame_interval_ms) return 0;
+
+	// Clear the dirty flag first so that updates made during the render are not lost
+	render_dirty = 0;
+	ms_since_last_frame = 0;
+	frame_count = frame_count + 1;
+
+	(*Render_Scheduler_Render)();
+
+	return 1;
+}
+
+uint32_t Render_Scheduler_Get_Frame_Count(void)
+{
+	return frame_count;
+}
+
+uint32_t Render_Scheduler_Get_Update_Count(void)
+{
+	return update_count;
+}
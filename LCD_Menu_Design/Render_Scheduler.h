@@ -0,0 +1,86 @@
+/**
+ * @file Render_Scheduler.h
+ *
+ * @brief Header file for the Render_Scheduler driver.
+ *
+ * This file contains the function definitions for the Render_Scheduler driver.
+ * It limits how often the display is redrawn while always showing the latest state.
+ *
+ * Updates only mark the state as dirty with Render_Scheduler_Mark_Dirty, which can be called from an
+ * interrupt service routine. The render function is executed by Render_Scheduler_Run from the main loop,
+ * at most once per frame interval. Any number of updates that occur within the same frame interval
+ * are coalesced into a single redraw, so the time spent on the display bus per second is bounded
+ * while the latest state is shown within one frame interval.
+ *
+ * @note Render_Scheduler_Tick must be called every 1 ms (e.g. from the Timer 0A periodic task).
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+/**
+ * @brief Initializes the render scheduler.
+ *
+ * This function stores the render function and computes the frame interval from the maximum frame rate.
+ * The state is marked as dirty so that the first frame is rendered on the next call to Render_Scheduler_Run.
+ *
+ * @param render A pointer to the user-defined function that redraws the display from the current state.
+ *
+ * @param max_frame_rate The maximum number of frames rendered per second (1 - 1000).
+ *
+ * @return None
+ */
+void Render_Scheduler_Init(void(*render)(void), uint32_t max_frame_rate);
+
+/**
+ * @brief Marks the displayed state as outdated.
+ *
+ * This function can be called from an interrupt service routine.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Render_Scheduler_Mark_Dirty(void);
+
+/**
+ * @brief Advances the time base of the render scheduler by 1 ms.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Render_Scheduler_Tick(void);
+
+/**
+ * @brief Renders a frame if the state is dirty and the frame interval has elapsed.
+ *
+ * The dirty flag is cleared before the render function is executed, so an update
+ * that occurs while the frame is being drawn will be shown in the next frame.
+ *
+ * @param None
+ *
+ * @return Returns 1 if a frame was rendered. Otherwise, it returns 0.
+ */
+uint8_t Render_Scheduler_Run(void);
+
+/**
+ * @brief Returns the number of frames rendered since initialization.
+ *
+ * @param None
+ *
+ * @return The number of frames rendered.
+ */
+uint32_t Render_Scheduler_Get_Frame_Count(void);
+
+/**
+ * @brief Returns the number of updates marked since initialization.
+ *
+ * The difference between the update count and the frame count is the number of updates that were coalesced.
+ *
+ * @param None
+ *
+ * @return The number of calls to Render_Scheduler_Mark_Dirty.
+ */
+uint32_t Render_Scheduler_Get_Update_Count(void);
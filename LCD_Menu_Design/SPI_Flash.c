@@ -0,0 +1,183 @@
+/**
+ * @file SPI_Flash.c
+ *
+ * @brief Source code for the SPI_Flash driver.
+ *
+ * This file contains the function definitions for the SPI_Flash driver.
+ * It reads an external SPI NOR flash device (e.g. W25Q32) connected to the SSI2 bus of the EduBase Board.
+ * The following pins are used:
+ *  - SSI2 Clock       [SCK]   (PB4)
+ *  - SSI2 Receive     [MISO]  (PB6)
+ *  - SSI2 Transmit    [MOSI]  (PB7)
+ *  - Chip Select      [CS]    (PE1)
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "SPI_Flash.h"
+#include "Asset_Store.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
+
+// Prescale value of the SSI2 clock used by the other device on the bus, restored after each transaction
+static uint32_t saved_cpsr = SPI_FLASH_CPSR;
+
+// Set while a flash transaction is using the SSI2 bus, and checked by the seven-segment display backend
+static volatile uint8_t spi_flash_bus_busy = 0;
+
+const Asset_Flash SPI_Flash_Asset_Flash =
+{
+	SPI_FLASH_SIZE,
+	SPI_Flash_Read
+};
+
+// Transmits a byte and returns the byte received at the same time
+static uint8_t SPI_Flash_Transfer(uint8_t data)
+{
+	// Wait until the transmit FIFO is not full (TNF, Bit 1 of the SSISR register)
+	while (!(SSI2->SR & 0x02));
+
+	SSI2->DR = data;
+
+	// Wait until the receive FIFO is not empty (RNE, Bit 2 of the SSISR register)
+	while (!(SSI2->SR & 0x04));
+
+	return (uint8_t)SSI2->DR;
+}
+
+// Asserts the chip select pin after discarding the bytes received during previous transfers on the bus
+static void SPI_Flash_Select(void)
+{
+	// Claim the bus before accessing SSI2 so that the seven-segment display backend
+	// is not refreshed from the Timer 0A interrupt during the transaction
+	spi_flash_bus_busy = 1;
+
+	// Wait until the previous transfer is done by checking the BSY bit (Bit 4) of the SSISR register
+	while (SSI2->SR & 0x10);
+
+	// The Seven-Segment Display driver does not read the bytes received while it transmits
+	while (SSI2->SR & 0x04)
+	{
+		(void)SSI2->DR;
+	}
+
+	// The Seven-Segment Display driver uses a lower SSI2 clock frequency
+	// The prescale value can only be changed while SSI2 is disabled (SSE, Bit 1 of the SSICR1 register)
+	saved_cpsr = SSI2->CPSR;
+	if (saved_cpsr != SPI_FLASH_CPSR)
+	{
+		SSI2->CR1 &= ~0x02;
+		SSI2->CPSR = SPI_FLASH_CPSR;
+		SSI2->CR1 |= 0x02;
+	}
+
+	// Assert the chip select pin (active low) by clearing Bit 1 of the DATA register for Port E
+	GPIO_PORT_E->DATA &= ~0x02;
+}
+
+static void SPI_Flash_Deselect(void)
+{
+	// Deassert the chip select pin by setting Bit 1 of the DATA register for Port E
+	GPIO_PORT_E->DATA |= 0x02;
+
+	// Restore the prescale value used by the other device on the bus
+	// Every transfer has completed, since the last received byte has been read
+	if (saved_cpsr != SPI_FLASH_CPSR)
+	{
+		SSI2->CR1 &= ~0x02;
+		SSI2->CPSR = saved_cpsr;
+		SSI2->CR1 |= 0x02;
+	}
+
+	spi_flash_bus_busy = 0;
+}
+
+void SPI_Flash_Init(void)
+{
+	// Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
+	// Enable the clocks to Port B, Port E and SSI2 and wait until they are ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_B);
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_E);
+	Clock_Manager_Acquire(CLOCK_SSI, 2);
+	
+	// Configure PB4 (SSI2 CLK), PB6 (SSI2 RX Data) and PB7 (SSI2 TX Data) to use the alternate function
+	// by setting Bits 7, 6 and 4 in the AFSEL register
+	GPIO_PORT_B->AFSEL |= 0xD0;
+	
+	// Enable the SSI2 function for PB4, PB6 and PB7
+	// by writing 0x2 to the PMC4, PMC6 and PMC7 fields in the PCTL register
+	GPIO_PORT_B->PCTL = (GPIO_PORT_B->PCTL & ~0xFF0F0000) | 0x22020000;
+	
+	// Enable the digital functionality for PB4, PB6 and PB7
+	GPIO_PORT_B->DEN |= 0xD0;
+	
+	// Configure PE1 as an output GPIO pin for the chip select of the flash device
+	GPIO_PORT_E->DIR |= 0x02;
+	GPIO_PORT_E->AFSEL &= ~0x02;
+	GPIO_PORT_E->DEN |= 0x02;
+	
+	// Initialize the output of PE1 to high (deasserted)
+	GPIO_PORT_E->DATA |= 0x02;
+	
+	// Keep the prescale value of the Seven-Segment Display if it has already enabled SSI2
+	uint32_t bus_cpsr = (SSI2->CR1 & 0x02) ? SSI2->CPSR : SPI_FLASH_CPSR;
+
+	// Disable SSI2 during configuration
+	SSI2->CR1 = 0;
+	
+	// Use the precision internal oscillator (16 MHz) as the clock source
+	SSI2->CC = 5;
+	
+	// The prescale value is set to 2 at the start of each transaction
+	// New clock frequency = (16 MHz / 2) = 8 MHz
+	SSI2->CPSR = bus_cpsr;
+	
+	// Select 8-bit data format (DSS = 0x07) and the Freescale SPI Frame Format (FRF = 0)
+	// with a steady state low clock (SPO = 0), data captured on the first clock edge (SPH = 0)
+	// and a Serial Clock Rate of 0 (SCR = 0)
+	SSI2->CR0 = 0x0007;
+	
+	// Enable SSI2 in master mode by setting the SSE bit (Bit 1) in the SSICR1 register
+	SSI2->CR1 |= 0x02;
+}
+
+uint32_t SPI_Flash_Read_JEDEC_ID(void)
+{
+	SPI_Flash_Select();
+
+	SPI_Flash_Transfer(SPI_FLASH_READ_JEDEC_ID);
+
+	uint32_t id = SPI_Flash_Transfer(0xFF);
+	id = (id << 8) | SPI_Flash_Transfer(0xFF);
+	id = (id << 8) | SPI_Flash_Transfer(0xFF);
+
+	SPI_Flash_Deselect();
+
+	return id;
+}
+
+void SPI_Flash_Read(uint32_t address, uint8_t* buffer, uint32_t length)
+{
+	SPI_Flash_Select();
+
+	// Transmit the command followed by the 24-bit address (most significant byte first)
+	SPI_Flash_Transfer(SPI_FLASH_READ_DATA);
+	SPI_Flash_Transfer((uint8_t)(address >> 16));
+	SPI_Flash_Transfer((uint8_t)(address >> 8));
+	SPI_Flash_Transfer((uint8_t)address);
+
+	// The flash device outputs consecutive bytes for as long as the chip select pin is asserted
+	for (uint32_t i = 0; i < length; i++)
+	{
+		buffer[i] = SPI_Flash_Transfer(0xFF);
+	}
+
+	SPI_Flash_Deselect();
+}
+
+uint8_t SPI_Flash_Is_Busy(void)
+{
+	return spi_flash_bus_busy;
+}
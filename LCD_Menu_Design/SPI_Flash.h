@@ -0,0 +1,86 @@
+/**
+ * @file SPI_Flash.h
+ *
+ * @brief Header file for the SPI_Flash driver.
+ *
+ * This file contains the function definitions for the SPI_Flash driver.
+ * It reads an external SPI NOR flash device (e.g. W25Q32) connected to the SSI2 bus of the EduBase Board.
+ * The following pins are used:
+ *  - SSI2 Clock       [SCK]   (PB4)
+ *  - SSI2 Receive     [MISO]  (PB6)
+ *  - SSI2 Transmit    [MOSI]  (PB7)
+ *  - Chip Select      [CS]    (PE1)
+ *
+ * The flash device shares the SSI2 bus with the Seven-Segment Display, which uses PC7 as its chip select pin.
+ * SSI2 is clocked at 8 MHz during each flash transaction. The prescale value used by the Seven-Segment Display
+ * (1 MHz) is restored when the chip select pin is deasserted, so the two drivers can be initialized in any order.
+ * The flash is read with the Read Data (0x03) command.
+ * The contents of the flash are programmed externally with an image generated by Tools/build_asset_image.py,
+ * and the flash is read through the Asset_Store module (see SPI_Flash_Asset_Flash in Asset_Store.h).
+ *
+ * @note PB6 is also used by the PWM0_0 driver (M0PWM0), so the two drivers cannot be used together.
+ *
+ * @note The functions of this driver must not be called from interrupt service routines, because the
+ * Seven-Segment Display driver also uses the SSI2 bus from the main loop. The seven-segment display backend
+ * is refreshed from the Timer 0A periodic task (Display_Refresh), so it checks SPI_Flash_Is_Busy and skips
+ * the refresh while a flash transaction is in progress.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+// Size of the flash device (in bytes)
+#ifndef SPI_FLASH_SIZE
+#define SPI_FLASH_SIZE              0x400000
+#endif
+
+// Prescale value of the SSI2 clock during a flash transaction (16 MHz PIOSC / 2 = 8 MHz)
+#define SPI_FLASH_CPSR              2
+
+#define SPI_FLASH_READ_DATA         0x03
+#define SPI_FLASH_READ_JEDEC_ID     0x9F
+
+/**
+ * @brief Initializes the SSI2 module and the pins used by the flash device.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void SPI_Flash_Init(void);
+
+/**
+ * @brief Reads the JEDEC ID of the flash device.
+ *
+ * @param None
+ *
+ * @return The manufacturer ID (Bits 23 to 16), the memory type (Bits 15 to 8) and the capacity (Bits 7 to 0).
+ * A value of 0x000000 or 0xFFFFFF indicates that no flash device is connected.
+ */
+uint32_t SPI_Flash_Read_JEDEC_ID(void);
+
+/**
+ * @brief Reads data from the flash device.
+ *
+ * @param address The address of the first byte to be read.
+ *
+ * @param buffer A pointer to the buffer that receives the data.
+ *
+ * @param length The number of bytes to be read.
+ *
+ * @return None
+ */
+void SPI_Flash_Read(uint32_t address, uint8_t* buffer, uint32_t length);
+
+/**
+ * @brief Indicates whether a flash transaction is using the SSI2 bus.
+ *
+ * Interrupt service routines that use the SSI2 bus must not access it while this function returns 1.
+ *
+ * @param None
+ *
+ * @return 1 from the start of a flash transaction until the chip select pin has been deasserted
+ * and the prescale value has been restored, or 0 otherwise.
+ */
+uint8_t SPI_Flash_Is_Busy(void);
@@ -0,0 +1,318 @@
+/**
+ * @file Settings.c
+ *
+ * @brief Source code for the Settings driver.
+ *
+ * This file contains the function definitions for the Settings driver.
+ * It stores the user settings in the TM4C123GH6PM on-chip EEPROM and keeps a copy of each setting in RAM.
+ *
+ * Settings_Get only reads the copy in RAM, and Settings_Set only updates the copy in RAM, so neither function
+ * waits for the EEPROM. Changed settings are written back by Settings_Run from the main loop once they
+ * have not changed for SETTINGS_COALESCE_DELAY_MS, so turning the rotary encoder through several values only
+ * programs the final value. At most one word is programmed every SETTINGS_MIN_WRITE_INTERVAL_MS and
+ * Settings_Run never waits for a program cycle to complete, which limits the wear of the EEPROM.
+ *
+ * Each setting occupies one 32-bit word in EEPROM Block 0. Word 0 holds a header that identifies the layout.
+ * If the header does not match (e.g. the first time the program is run), the default values are used and written.
+ *
+ * The clock to the EEPROM module is only enabled while settings are being written back. It is disabled
+ * once the last program cycle has completed, and the EEPROM keeps its contents while its clock is disabled.
+ *
+ * @note Settings_Tick must be called every 1 ms (e.g. from the Timer 0A periodic task).
+ *
+ * @note For more information regarding the EEPROM, refer to Chapter 8 (Internal Memory)
+ * of the TM4C123G Microcontroller Datasheet.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Settings.h"
+#include "Clock_Manager.h"
+
+// Header stored in word 0 of Block 0
+// The lower byte must be changed whenever the layout of the settings is changed
+#define SETTINGS_HEADER             0x53450001
+
+#define SETTINGS_EEPROM_BLOCK       0
+
+// WORKING bit (Bit 0) in the EEDONE register
+#define EEPROM_WORKING              0x01
+
+// PRETRY (Bit 3) and ERETRY (Bit 2) bits in the EESUPP register
+#define EEPROM_RETRY_ERRORS         0x0C
+
+typedef struct
+{
+	uint32_t minimum;
+	uint32_t maximum;
+	uint32_t default_value;
+} Setting_Descriptor;
+
+// Valid range and default value of each setting (indexed by Settings_IDs)
+static const Setting_Descriptor settings_descriptors[SETTINGS_COUNT] =
+{
+	{0, 100, 100},      // LED brightness (%)
+	{0, 10, 5},         // Tone volume
+	{0, 7, 0}           // Default screen (main menu item)
+};
+
+// Values read by Settings_Get and the values that are stored in the EEPROM
+static volatile uint32_t settings_cache[SETTINGS_COUNT];
+static uint32_t settings_stored[SETTINGS_COUNT];
+
+static uint8_t settings_header_valid = 0;
+static uint8_t eeprom_available = 0;
+
+// Time elapsed since a setting was changed and since a word was programmed (saturate at their limits)
+static volatile uint32_t ms_since_last_change = 0;
+static volatile uint32_t ms_since_last_write = 0;
+
+static uint32_t write_count = 0;
+
+static uint8_t eeprom_clock_enabled = 0;
+
+// Enables the clock to the EEPROM module before it is accessed
+static void Settings_EEPROM_Clock_Enable(void)
+{
+	if (!eeprom_clock_enabled)
+	{
+		eeprom_clock_enabled = Clock_Manager_Acquire(CLOCK_EEPROM, 0);
+	}
+}
+
+// Disables the clock to the EEPROM module
+// It must not be called while a program cycle is in progress
+static void Settings_EEPROM_Clock_Disable(void)
+{
+	if (eeprom_clock_enabled)
+	{
+		Clock_Manager_Release(CLOCK_EEPROM, 0);
+		eeprom_clock_enabled = 0;
+	}
+}
+
+// Returns 1 if a setting or the header still has to be written to the EEPROM
+static uint8_t Settings_Write_Pending(void)
+{
+	if (!settings_header_valid) return 1;
+
+	for (uint8_t id = 0; id < SETTINGS_COUNT; id++)
+	{
+		if (settings_cache[id] != settings_stored[id]) return 1;
+	}
+
+	return 0;
+}
+
+static uint32_t Settings_EEPROM_Read(uint32_t offset)
+{
+	EEPROM->EEBLOCK = SETTINGS_EEPROM_BLOCK;
+	EEPROM->EEOFFSET = offset;
+	return EEPROM->EERDWR;
+}
+
+static void Settings_EEPROM_Write(uint32_t offset, uint32_t value)
+{
+	// Writing to the EERDWR register starts the program cycle
+	// The WORKING bit in the EEDONE register remains set until it has completed
+	EEPROM->EEBLOCK = SETTINGS_EEPROM_BLOCK;
+	EEPROM->EEOFFSET = offset;
+	EEPROM->EERDWR = value;
+
+	ms_since_last_write = 0;
+	write_count = write_count + 1;
+}
+
+// Starts the program cycle for the first setting that differs from the EEPROM, followed by the header
+// Returns 0 if every setting is already stored
+static uint8_t Settings_Write_Next(void)
+{
+	for (uint8_t id = 0; id < SETTINGS_COUNT; id++)
+	{
+		uint32_t value = settings_cache[id];
+
+		if (value != settings_stored[id])
+		{
+			// The setting occupies the word following the header
+			Settings_EEPROM_Write(id + 1, value);
+			settings_stored[id] = value;
+			return 1;
+		}
+	}
+
+	// The header is only written after every setting so that an interrupted
+	// first write-back is detected on the next startup
+	if (!settings_header_valid)
+	{
+		Settings_EEPROM_Write(0, SETTINGS_HEADER);
+		settings_header_valid = 1;
+		return 1;
+	}
+
+	return 0;
+}
+
+void Settings_Init(void)
+{
+	for (uint8_t id = 0; id < SETTINGS_COUNT; id++)
+	{
+		settings_cache[id] = settings_descriptors[id].default_value;
+		settings_stored[id] = settings_descriptors[id].default_value;
+	}
+
+	ms_since_last_change = SETTINGS_COALESCE_DELAY_MS;
+	ms_since_last_write = SETTINGS_MIN_WRITE_INTERVAL_MS;
+	write_count = 0;
+
+	// Enable the clock to the EEPROM module and wait until it is ready to be accessed
+	Settings_EEPROM_Clock_Enable();
+
+	// Wait until the EEPROM has completed its power-on recovery by polling the WORKING bit in the EEDONE register
+	while (EEPROM->EEDONE & EEPROM_WORKING);
+
+	// The EEPROM cannot be used if the PRETRY or ERETRY bits are set in the EESUPP register
+	if (EEPROM->EESUPP & EEPROM_RETRY_ERRORS)
+	{
+		eeprom_available = 0;
+		Settings_EEPROM_Clock_Disable();
+		return;
+	}
+
+	// Reset the EEPROM module by setting and clearing the R0 bit (Bit 0) in the SREEPROM register
+	// as required by the initialization sequence in the datasheet
+	SYSCTL->SREEPROM = 0x01;
+	SYSCTL->SREEPROM = 0x00;
+
+	// Wait until the EEPROM module is ready to be accessed after the reset
+	while ((SYSCTL->PREEPROM & 0x01) == 0);
+
+	// Wait for the EEPROM to complete its recovery again and check the EESUPP register for errors
+	while (EEPROM->EEDONE & EEPROM_WORKING);
+
+	if (EEPROM->EESUPP & EEPROM_RETRY_ERRORS)
+	{
+		eeprom_available = 0;
+		Settings_EEPROM_Clock_Disable();
+		return;
+	}
+
+	eeprom_available = 1;
+	settings_header_valid = (Settings_EEPROM_Read(0) == SETTINGS_HEADER);
+
+	if (!settings_header_valid)
+	{
+		// Force every default value to be written by the next write-back
+		for (uint8_t id = 0; id < SETTINGS_COUNT; id++)
+		{
+			settings_stored[id] = ~settings_descriptors[id].default_value;
+		}
+
+		// Keep the clock enabled for the first write-back
+		return;
+	}
+
+	for (uint8_t id = 0; id < SETTINGS_COUNT; id++)
+	{
+		uint32_t value = Settings_EEPROM_Read(id + 1);
+		settings_stored[id] = value;
+
+		// Keep the default value if the stored value is outside of the valid range
+		// The default value will be written by the next write-back
+		if (value >= settings_descriptors[id].minimum && value <= settings_descriptors[id].maximum)
+		{
+			settings_cache[id] = value;
+		}
+	}
+
+	// The clock is enabled again by Settings_Run when a setting has changed
+	if (!Settings_Write_Pending())
+	{
+		Settings_EEPROM_Clock_Disable();
+	}
+}
+
+uint32_t Settings_Get(uint8_t id)
+{
+	if (id >= SETTINGS_COUNT) return 0;
+
+	return settings_cache[id];
+}
+
+void Settings_Set(uint8_t id, uint32_t value)
+{
+	if (id >= SETTINGS_COUNT) return;
+
+	if (value < settings_descriptors[id].minimum)
+	{
+		value = settings_descriptors[id].minimum;
+	}
+	else if (value > settings_descriptors[id].maximum)
+	{
+		value = settings_descriptors[id].maximum;
+	}
+
+	if (value != settings_cache[id])
+	{
+		settings_cache[id] = value;
+		ms_since_last_change = 0;
+	}
+}
+
+void Settings_Tick(void)
+{
+	if (ms_since_last_change < SETTINGS_COALESCE_DELAY_MS)
+	{
+		ms_since_last_change = ms_since_last_change + 1;
+	}
+
+	if (ms_since_last_write < SETTINGS_MIN_WRITE_INTERVAL_MS)
+	{
+		ms_since_last_write = ms_since_last_write + 1;
+	}
+}
+
+uint8_t Settings_Run(void)
+{
+	if (!eeprom_available) return 0;
+
+	if (!Settings_Write_Pending())
+	{
+		// Disable the clock once the last program cycle has completed
+		if (eeprom_clock_enabled && !(EEPROM->EEDONE & EEPROM_WORKING))
+		{
+			Settings_EEPROM_Clock_Disable();
+		}
+		return 0;
+	}
+
+	if (ms_since_last_change < SETTINGS_COALESCE_DELAY_MS || ms_since_last_write < SETTINGS_MIN_WRITE_INTERVAL_MS) return 0;
+
+	Settings_EEPROM_Clock_Enable();
+
+	// Do not wait for the previous program cycle to complete
+	if (EEPROM->EEDONE & EEPROM_WORKING) return 0;
+
+	return Settings_Write_Next();
+}
+
+void Settings_Flush(void)
+{
+	if (!eeprom_available) return;
+
+	Settings_EEPROM_Clock_Enable();
+
+	do
+	{
+		while (EEPROM->EEDONE & EEPROM_WORKING);
+	}
+	while (Settings_Write_Next());
+
+	while (EEPROM->EEDONE & EEPROM_WORKING);
+
+	Settings_EEPROM_Clock_Disable();
+}
+
+uint32_t Settings_Get_Write_Count(void)
+{
+	return write_count;
+}
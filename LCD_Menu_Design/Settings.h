@@ -0,0 +1,122 @@
+/**
+ * @file Settings.h
+ *
+ * @brief Header file for the Settings driver.
+ *
+ * This file contains the function definitions for the Settings driver.
+ * It stores the user settings in the TM4C123GH6PM on-chip EEPROM and keeps a copy of each setting in RAM.
+ *
+ * Settings_Get only reads the copy in RAM, and Settings_Set only updates the copy in RAM, so neither function
+ * waits for the EEPROM. Changed settings are written back by Settings_Run from the main loop once they
+ * have not changed for SETTINGS_COALESCE_DELAY_MS, so turning the rotary encoder through several values only
+ * programs the final value. At most one word is programmed every SETTINGS_MIN_WRITE_INTERVAL_MS and
+ * Settings_Run never waits for a program cycle to complete, which limits the wear of the EEPROM.
+ *
+ * Each setting occupies one 32-bit word in EEPROM Block 0. Word 0 holds a header that identifies the layout.
+ * If the header does not match (e.g. the first time the program is run), the default values are used and written.
+ *
+ * The clock to the EEPROM module is only enabled while settings are being written back. It is disabled
+ * once the last program cycle has completed, and the EEPROM keeps its contents while its clock is disabled.
+ *
+ * @note Settings_Tick must be called every 1 ms (e.g. from the Timer 0A periodic task).
+ *
+ * @note For more information regarding the EEPROM, refer to Chapter 8 (Internal Memory)
+ * of the TM4C123G Microcontroller Datasheet.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+// Time that a setting must remain unchanged before it is written to the EEPROM (in ms)
+#define SETTINGS_COALESCE_DELAY_MS          2000
+
+// Minimum time between two words being programmed (in ms)
+#define SETTINGS_MIN_WRITE_INTERVAL_MS      1000
+
+enum Settings_IDs
+{
+	SETTING_LED_BRIGHTNESS      = 0x00,
+	SETTING_TONE_VOLUME         = 0x01,
+	SETTING_DEFAULT_SCREEN      = 0x02,
+	SETTINGS_COUNT              = 0x03
+};
+
+/**
+ * @brief Initializes the EEPROM and loads the settings into RAM.
+ *
+ * This function enables the clock to the EEPROM module and waits until the EEPROM has recovered from
+ * any interrupted program cycle. Settings that are outside of their valid range are replaced by their default values.
+ * If the EEPROM cannot be used, the default values are kept in RAM and are never written.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Settings_Init(void);
+
+/**
+ * @brief Returns the value of a setting.
+ *
+ * @param id The setting to be read (e.g. SETTING_LED_BRIGHTNESS).
+ *
+ * @return The value of the setting, or 0 if the setting does not exist.
+ */
+uint32_t Settings_Get(uint8_t id);
+
+/**
+ * @brief Changes the value of a setting.
+ *
+ * The value is limited to the valid range of the setting and is written back to the EEPROM later
+ * by Settings_Run. This function can be called from an interrupt service routine.
+ *
+ * @param id The setting to be changed (e.g. SETTING_LED_BRIGHTNESS).
+ *
+ * @param value The new value of the setting.
+ *
+ * @return None
+ */
+void Settings_Set(uint8_t id, uint32_t value);
+
+/**
+ * @brief Advances the time base of the settings write-back by 1 ms.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Settings_Tick(void);
+
+/**
+ * @brief Writes one changed setting to the EEPROM if the write-back conditions are met.
+ *
+ * A word is only programmed when no setting has changed for SETTINGS_COALESCE_DELAY_MS, at least
+ * SETTINGS_MIN_WRITE_INTERVAL_MS have elapsed since the previous word was programmed, and the EEPROM
+ * is not busy. The function returns immediately after starting the program cycle.
+ *
+ * @param None
+ *
+ * @return Returns 1 if a program cycle was started. Otherwise, it returns 0.
+ */
+uint8_t Settings_Run(void);
+
+/**
+ * @brief Writes every changed setting to the EEPROM and waits until the last program cycle has completed.
+ *
+ * The coalescing delay and the write interval are ignored. This function should be called before
+ * the power is removed or the device enters a low-power mode.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Settings_Flush(void);
+
+/**
+ * @brief Returns the number of words programmed since initialization.
+ *
+ * @param None
+ *
+ * @return The number of EEPROM words written.
+ */
+uint32_t Settings_Get_Write_Count(void);
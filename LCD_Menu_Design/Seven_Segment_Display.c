@@ -12,6 +12,8 @@
  */
  
 #include "Seven_Segment_Display.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
 
 // Values used to represent numbers on the Seven-Segment Display module
 const uint8_t number_pattern[16] =
@@ -36,39 +38,42 @@ const uint8_t number_pattern[16] =
 
 void Seven_Segment_Display_Init(void)
 {
+	// Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
 	// Enable the clock to Port B (Bit 1)
-	SYSCTL->RCGCGPIO |= 0x02;
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_B);
 
 	// Enable the clock to Port C (Bit 2)
-	SYSCTL->RCGCGPIO |= 0x04;
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_C);
 
 	// Enable the clock to SSI2 (Bit 2)
-	SYSCTL->RCGCSSI |= 0x04;
+	Clock_Manager_Acquire(CLOCK_SSI, 2);
 
 	// Configure PB4 (SSI2 CLK) and PB7 (SSI2 TX Data) to use alternate function
-	GPIOB->AFSEL |= 0x90;
+	GPIO_PORT_B->AFSEL |= 0x90;
 
 	// Clear functions for PB4 (SSI2 CLK) and PB7 (SSI2 TX Data)
-	GPIOB->PCTL &= ~0xF00F0000;
+	GPIO_PORT_B->PCTL &= ~0xF00F0000;
 
 	// Enable SSI2 function for PB4 (SSI2 CLK) and PB7 (SSI2 TX Data)
-	GPIOB->PCTL |= 0x20020000;
+	GPIO_PORT_B->PCTL |= 0x20020000;
 
 	// Enable digital functionality for PB4 and PB7
-	GPIOB->DEN |= 0x90;
+	GPIO_PORT_B->DEN |= 0x90;
 
 	// Set PC7 as an output GPIO pin for SSI2 Slave Select (SSI2 SS)
 	// Note: Slave Select pin is active low
-	GPIOC->DIR |= 0x80;
+	GPIO_PORT_C->DIR |= 0x80;
 
 	// Configure PC7 (SSI2 SS) to function as a GPIO pin
-	GPIOC->AFSEL &= ~0x80;
+	GPIO_PORT_C->AFSEL &= ~0x80;
 
 	// Enable digital functionality for PC7 (SSI2 SS)
-	GPIOC->DEN |= 0x80;
+	GPIO_PORT_C->DEN |= 0x80;
 
 	// Initialize the output of PC7 (SSI2 SS) to high
-	GPIOC->DATA |= 0x80;
+	GPIO_PORT_C->DATA |= 0x80;
 
 	// Disable SSI2 during configuration
 	SSI2->CR1 = 0;
@@ -97,7 +102,7 @@ void SSI2_Write(uint8_t data)
 {
 	// Assert the slave select pin by clearing Bit 7
 	// of the DATA register for Port C
-	GPIOC->DATA &= ~0x80;
+	GPIO_PORT_C->DATA &= ~0x80;
 
 	// Write the data to the SSI Data Register (SSIDR)
 	SSI2->DR = data;
@@ -108,7 +113,7 @@ void SSI2_Write(uint8_t data)
 
 	// Deassert the slave select pin by setting Bit 7
 	// of the DATA register for Port C
-	GPIOC->DATA |= 0x80;
+	GPIO_PORT_C->DATA |= 0x80;
 }
 
 int Count_Digits(int value)
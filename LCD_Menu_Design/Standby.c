@@ -0,0 +1,272 @@
+/**
+ * @file Standby.c
+ *
+ * @brief Source code for the Standby driver.
+ *
+ * This file contains the function definitions for the Standby driver.
+ * It puts the microcontroller in deep-sleep mode while the board is idle and wakes it up
+ * when an edge is detected on one of the following pins:
+ *  - PMOD ENC Pin 1 (A)   / EduBase SW5 (PD0)
+ *  - PMOD ENC Pin 2 (B)   / EduBase SW4 (PD1)
+ *  - PMOD ENC Pin 3 (BTN) / EduBase SW3 (PD2)
+ *  - PMOD ENC Pin 4 (SWT) / EduBase SW2 (PD3)
+ *
+ * Before entering deep-sleep mode, the Deep-Sleep Clock Gating Control (DCGC) registers are configured so that
+ * only GPIO Port D and Wide Timer 0 remain clocked, and the deep-sleep clock is switched to the 16 MHz
+ * Precision Internal Oscillator (PIOSC). Upon wake-up, the run-mode clock and peripheral clocks are restored
+ * by hardware, the PLL lock is awaited, and the user-defined wake task (e.g. redrawing the current screen) is executed.
+ *
+ * Wide Timer 0 is used as a free-running 64-bit timestamp in both run and deep-sleep modes to report
+ * the wake latency and the fraction of time spent in deep-sleep mode. The prescaler is not available
+ * in the 64-bit configuration, so the timestamp counts system clock cycles (50 MHz in run mode,
+ * 16 MHz in deep-sleep mode) and does not wrap around while the board is powered.
+ *
+ * While in deep-sleep mode, the SysTick timer and every interrupt except GPIO Port D are disabled,
+ * since any pending interrupt would end the deep-sleep mode immediately. They are enabled again after waking up.
+ *
+ * @note The wake-up edge is handled with interrupts disabled, so no GPIO Port D interrupt is taken for it.
+ * The interrupt configuration of Port D is restored after waking up.
+ *
+ * @note Only the Port D pins can wake up the microcontroller. The PMOD BTN module (PA2 - PA5) is not a wake-up
+ * source, because PA2 - PA5 are used as the data pins of the EduBase LCD in this project.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Standby.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
+
+// Number of timestamp counts per us with the run-mode clock (50 MHz)
+// and with the deep-sleep clock (16 MHz PIOSC)
+#define RUN_MODE_COUNTS_PER_US      50
+#define DEEP_SLEEP_COUNTS_PER_US    16
+
+// Pointers to the user-defined tasks
+static void (*Standby_Enter_Task)(void);
+static void (*Standby_Wake_Task)(void);
+
+// Time accumulated in each state (in us) and the timestamp of the last update
+static uint64_t awake_time_us = 0;
+static uint64_t asleep_time_us = 0;
+static uint64_t last_timestamp = 0;
+
+static uint32_t wake_latency_us = 0;
+static uint32_t max_wake_latency_us = 0;
+static uint32_t sleep_count = 0;
+
+static uint64_t Standby_Read_Timestamp(void)
+{
+	uint32_t upper;
+	uint32_t lower;
+
+	// The upper 32 bits are held in GPTMTBV and the lower 32 bits in GPTMTAV
+	// Read the upper bits again to detect a borrow from the lower bits between the two reads
+	do
+	{
+		upper = WTIMER0->TBV;
+		lower = WTIMER0->TAV;
+	} while (upper != WTIMER0->TBV);
+
+	return ((uint64_t)upper << 32) | lower;
+}
+
+static uint64_t Standby_Elapsed_us(uint64_t timestamp, uint32_t counts_per_us)
+{
+	// Wide Timer 0 counts down, so the elapsed time is the previous value minus the current value
+	// The counts that do not make up a full us are carried over to the next call
+	uint64_t elapsed_us = (last_timestamp - timestamp) / counts_per_us;
+	last_timestamp = last_timestamp - (elapsed_us * counts_per_us);
+
+	return elapsed_us;
+}
+
+void Standby_Init(void(*enter_task)(void), void(*wake_task)(void))
+{
+	Standby_Enter_Task = enter_task;
+	Standby_Wake_Task = wake_task;
+
+	// Enable the clock to Wide Timer 0 and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_WIDE_TIMER, 0);
+
+	// Disable Wide Timer 0 and select the 64-bit timer configuration by writing 0x0 to the GPTMCFG register
+	WTIMER0->CTL &= ~0x01;
+	WTIMER0->CFG = 0x00;
+
+	// Select the Periodic Timer Mode and count down from the full 64-bit range
+	// The upper 32 bits of the interval are written to GPTMTBILR and the lower 32 bits to GPTMTAILR
+	WTIMER0->TAMR = 0x02;
+	WTIMER0->TBILR = 0xFFFFFFFF;
+	WTIMER0->TAILR = 0xFFFFFFFF;
+
+	WTIMER0->CTL |= 0x01;
+	last_timestamp = Standby_Read_Timestamp();
+
+	// Use the PIOSC without a divider as the deep-sleep clock by writing 0x1
+	// to the DSOSCSRC field (Bits 6 to 4) and clearing the DSDIVORIDE field (Bits 28 to 23)
+	// in the DSLPCLKCFG register
+	SYSCTL->DSLPCLKCFG = (0x1 << 4);
+
+	// Put the flash memory in low power mode (FLASHPM = 0x2, Bits 5 to 4) and the SRAM
+	// in standby mode (SRAMPM = 0x1, Bits 1 to 0) during deep-sleep mode
+	SYSCTL->DSLPPWRCFG = (0x2 << 4) | 0x1;
+
+	// Enable automatic clock gating by setting the ACG bit (Bit 27) in the RCC register
+	// so that the SCGC and DCGC registers are used in sleep and deep-sleep modes
+	SYSCTL->RCC |= (1UL << 27);
+
+	awake_time_us = 0;
+	asleep_time_us = 0;
+	wake_latency_us = 0;
+	max_wake_latency_us = 0;
+	sleep_count = 0;
+}
+
+void Standby_Enter(void)
+{
+	if (Standby_Enter_Task != 0)
+	{
+		(*Standby_Enter_Task)();
+	}
+
+	// Keep the clocks that are currently acquired through the clock manager in sleep mode
+	SYSCTL->SCGCGPIO = SYSCTL->RCGCGPIO;
+	SYSCTL->SCGCTIMER = SYSCTL->RCGCTIMER;
+	SYSCTL->SCGCWTIMER = SYSCTL->RCGCWTIMER;
+	SYSCTL->SCGCSSI = SYSCTL->RCGCSSI;
+	SYSCTL->SCGCPWM = SYSCTL->RCGCPWM;
+	SYSCTL->SCGCDMA = SYSCTL->RCGCDMA;
+
+	// In deep-sleep mode, only clock Port D (wake-up pins) and Wide Timer 0 (timestamp)
+	SYSCTL->DCGCGPIO = 0x08;
+	SYSCTL->DCGCWTIMER = 0x01;
+	SYSCTL->DCGCTIMER = 0x00;
+	SYSCTL->DCGCSSI = 0x00;
+	SYSCTL->DCGCPWM = 0x00;
+	SYSCTL->DCGCDMA = 0x00;
+	SYSCTL->DCGCEEPROM = 0x00;
+
+	// The wake-up edge is handled here with interrupts disabled
+	// A pending interrupt still wakes the processor from WFI when PRIMASK is set
+	__disable_irq();
+
+	// Save the interrupt configuration of Port D and detect both edges on the wake-up pins
+	uint32_t saved_im = GPIO_PORT_D->IM;
+	uint32_t saved_is = GPIO_PORT_D->IS;
+	uint32_t saved_ibe = GPIO_PORT_D->IBE;
+	uint32_t saved_iser = NVIC->ISER[0] & (1 << 3);
+
+	GPIO_PORT_D->IS &= ~STANDBY_WAKE_PINS_MASK;
+	GPIO_PORT_D->IBE |= STANDBY_WAKE_PINS_MASK;
+	GPIO_PORT_D->ICR = STANDBY_WAKE_PINS_MASK;
+	GPIO_PORT_D->IM |= STANDBY_WAKE_PINS_MASK;
+
+	// Any enabled interrupt that becomes pending ends WFI immediately, even though PRIMASK is set
+	// Stop the 1 us SysTick interrupt and discard a pending SysTick exception
+	uint32_t saved_systick_ctrl = SysTick->CTRL & 0x03;
+	SysTick->CTRL &= ~0x03;
+	SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+
+	// Disable every interrupt except GPIO Port D (e.g. the Timer 0A periodic task)
+	// The pending bits are kept, so the interrupts raised in the meantime are taken after waking up
+	uint32_t saved_nvic_iser[5];
+	for (uint8_t i = 0; i < 5; i++)
+	{
+		saved_nvic_iser[i] = NVIC->ISER[i];
+		NVIC->ICER[i] = 0xFFFFFFFF;
+	}
+	NVIC->ISER[0] = (1 << 3);
+
+	// Account for the time spent awake before the timestamp is clocked by the deep-sleep clock
+	awake_time_us = awake_time_us + Standby_Elapsed_us(Standby_Read_Timestamp(), RUN_MODE_COUNTS_PER_US);
+
+	// Enter deep-sleep mode by setting the SLEEPDEEP bit in the System Control register
+	SCB->SCR |= SCB_SCR_SLEEPDEEP_Msk;
+	__DSB();
+	__WFI();
+
+	// The wake latency is measured from the moment the processor resumes execution,
+	// so it includes the PLL lock, restoring the interrupts and the wake task
+	uint64_t wake_timestamp = Standby_Read_Timestamp();
+	SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
+
+	asleep_time_us = asleep_time_us + Standby_Elapsed_us(wake_timestamp, DEEP_SLEEP_COUNTS_PER_US);
+
+	// Only count the wake-ups caused by one of the wake-up pins
+	if (GPIO_PORT_D->RIS & STANDBY_WAKE_PINS_MASK)
+	{
+		sleep_count = sleep_count + 1;
+	}
+
+	// The run-mode clock has been restored by hardware. If the PLL is used (BYPASS2, Bit 11 in RCC2 cleared),
+	// wait until it has locked by checking the LOCK bit (Bit 0) in the PLLSTAT register
+	if ((SYSCTL->RCC2 & (1UL << 11)) == 0)
+	{
+		while ((SYSCTL->PLLSTAT & 0x01) == 0);
+	}
+
+	// Restore the interrupt configuration of Port D and discard the wake-up edge
+	GPIO_PORT_D->IM = saved_im;
+	GPIO_PORT_D->ICR = STANDBY_WAKE_PINS_MASK & ~saved_im;
+	GPIO_PORT_D->IS = saved_is;
+	GPIO_PORT_D->IBE = saved_ibe;
+
+	if (saved_iser == 0)
+	{
+		NVIC->ICPR[0] = (1 << 3);
+	}
+
+	// Enable the interrupts and the SysTick timer again
+	// The SysTick timer is needed by the wake task (e.g. for the delays of the LCD commands)
+	NVIC->ICER[0] = (1 << 3);
+	for (uint8_t i = 0; i < 5; i++)
+	{
+		NVIC->ISER[i] = saved_nvic_iser[i];
+	}
+
+	SysTick->VAL = 0;
+	SysTick->CTRL |= saved_systick_ctrl;
+
+	__enable_irq();
+
+	// Execute the wake task and measure the time taken to resume operation since the wake-up edge
+	if (Standby_Wake_Task != 0)
+	{
+		(*Standby_Wake_Task)();
+	}
+
+	wake_latency_us = (uint32_t)Standby_Elapsed_us(Standby_Read_Timestamp(), RUN_MODE_COUNTS_PER_US);
+	awake_time_us = awake_time_us + wake_latency_us;
+
+	if (wake_latency_us > max_wake_latency_us)
+	{
+		max_wake_latency_us = wake_latency_us;
+	}
+}
+
+uint32_t Standby_Get_Wake_Latency_us(void)
+{
+	return wake_latency_us;
+}
+
+uint32_t Standby_Get_Max_Wake_Latency_us(void)
+{
+	return max_wake_latency_us;
+}
+
+uint32_t Standby_Get_Sleep_Ratio(void)
+{
+	awake_time_us = awake_time_us + Standby_Elapsed_us(Standby_Read_Timestamp(), RUN_MODE_COUNTS_PER_US);
+
+	uint64_t total_time_us = awake_time_us + asleep_time_us;
+	if (total_time_us == 0) return 0;
+
+	return (uint32_t)((asleep_time_us * 1000) / total_time_us);
+}
+
+uint32_t Standby_Get_Sleep_Count(void)
+{
+	return sleep_count;
+}
@@ -0,0 +1,110 @@
+/**
+ * @file Standby.h
+ *
+ * @brief Header file for the Standby driver.
+ *
+ * This file contains the function definitions for the Standby driver.
+ * It puts the microcontroller in deep-sleep mode while the board is idle and wakes it up
+ * when an edge is detected on one of the following pins:
+ *  - PMOD ENC Pin 1 (A)   / EduBase SW5 (PD0)
+ *  - PMOD ENC Pin 2 (B)   / EduBase SW4 (PD1)
+ *  - PMOD ENC Pin 3 (BTN) / EduBase SW3 (PD2)
+ *  - PMOD ENC Pin 4 (SWT) / EduBase SW2 (PD3)
+ *
+ * Before entering deep-sleep mode, the Deep-Sleep Clock Gating Control (DCGC) registers are configured so that
+ * only GPIO Port D and Wide Timer 0 remain clocked, and the deep-sleep clock is switched to the 16 MHz
+ * Precision Internal Oscillator (PIOSC). Upon wake-up, the run-mode clock and peripheral clocks are restored
+ * by hardware, the PLL lock is awaited, and the user-defined wake task (e.g. redrawing the current screen) is executed.
+ *
+ * Wide Timer 0 is used as a free-running 64-bit timestamp in both run and deep-sleep modes to report
+ * the wake latency and the fraction of time spent in deep-sleep mode. The prescaler is not available
+ * in the 64-bit configuration, so the timestamp counts system clock cycles (50 MHz in run mode,
+ * 16 MHz in deep-sleep mode) and does not wrap around while the board is powered.
+ *
+ * While in deep-sleep mode, the SysTick timer and every interrupt except GPIO Port D are disabled,
+ * since any pending interrupt would end the deep-sleep mode immediately. They are enabled again after waking up.
+ *
+ * @note The wake-up edge is handled with interrupts disabled, so no GPIO Port D interrupt is taken for it.
+ * The interrupt configuration of Port D is restored after waking up.
+ *
+ * @note Only the Port D pins can wake up the microcontroller. The PMOD BTN module (PA2 - PA5) is not a wake-up
+ * source, because PA2 - PA5 are used as the data pins of the EduBase LCD in this project.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+// Pins of Port D that wake the microcontroller from deep-sleep mode
+#define STANDBY_WAKE_PINS_MASK      0x0F
+
+/**
+ * @brief Initializes the Standby driver.
+ *
+ * This function enables the automatic clock gating (ACG) of the RCC register so that the Sleep-Mode
+ * and Deep-Sleep-Mode Clock Gating Control registers are used, selects the deep-sleep clock source,
+ * and starts the 64-bit Wide Timer 0 timestamp.
+ *
+ * @param enter_task A pointer to the user-defined function executed before entering deep-sleep mode
+ *                   (e.g. turning off the display). A null pointer can be passed.
+ *
+ * @param wake_task A pointer to the user-defined function executed after waking up
+ *                  (e.g. turning on the display and redrawing the current screen). A null pointer can be passed.
+ *
+ * @return None
+ */
+void Standby_Init(void(*enter_task)(void), void(*wake_task)(void));
+
+/**
+ * @brief Enters deep-sleep mode until an edge is detected on one of the wake-up pins.
+ *
+ * This function gates every peripheral clock except the wake-up port and the timestamp timer,
+ * enters deep-sleep mode, and returns after the wake task has been executed.
+ *
+ * @param None
+ *
+ * @return None
+ */
+void Standby_Enter(void);
+
+/**
+ * @brief Returns the time taken by the last wake-up.
+ *
+ * The wake latency is measured from the moment the processor resumes execution after the wake-up edge
+ * until the wake task has returned, so it includes the PLL lock. The counts are converted with the
+ * run-mode clock rate.
+ *
+ * @param None
+ *
+ * @return The wake latency in microseconds.
+ */
+uint32_t Standby_Get_Wake_Latency_us(void);
+
+/**
+ * @brief Returns the largest wake latency measured since initialization.
+ *
+ * @param None
+ *
+ * @return The wake latency in microseconds.
+ */
+uint32_t Standby_Get_Max_Wake_Latency_us(void);
+
+/**
+ * @brief Returns the fraction of time spent in deep-sleep mode since initialization.
+ *
+ * @param None
+ *
+ * @return The sleep ratio in parts per thousand (0 - 1000).
+ */
+uint32_t Standby_Get_Sleep_Ratio(void);
+
+/**
+ * @brief Returns the number of times deep-sleep mode was entered since initialization.
+ *
+ * @param None
+ *
+ * @return The number of deep-sleep periods.
+ */
+uint32_t Standby_Get_Sleep_Count(void);
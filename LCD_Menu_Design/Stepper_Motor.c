@@ -11,46 +11,203 @@
  *  - ULN2003 Stepper Motor Driver
  *  - 3.3V / 5V Breadboard Power Supply Module (External Power Source)
  *
+ * @note Stepper_Motor_Tick must be called every 1 ms. PWM Module 1 Generator 3 (PF2 and PF3) is used
+ * to reduce the holding current, so the PWM1_3 driver and the RGB LED cannot be used at the same time.
+ *
  * @author Aaron Nanas
  */
 
 #include "Stepper_Motor.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
+
+// Coil phases (PB3 - PB0) of the two-phase full-step sequence
+static const uint8_t step_phases[4] = {0x03, 0x06, 0x0C, 0x09};
+
+static uint8_t phase_index = 0;
+static int32_t position = 0;
+
+static volatile uint8_t power_state = STEPPER_MOTOR_POWER_OFF;
+static volatile uint32_t ms_since_step = 0;
+
+static uint16_t hold_duty_cycle = (STEPPER_MOTOR_PWM_PERIOD * STEPPER_MOTOR_DEFAULT_HOLD_PERCENT) / 100;
+static uint32_t settle_time_ms = STEPPER_MOTOR_DEFAULT_SETTLE_MS;
+static uint32_t idle_time_ms = STEPPER_MOTOR_DEFAULT_IDLE_MS;
  
+// Drives the coils with the full current, a reduced holding current, or de-energizes them
+static void Stepper_Motor_Set_Power_State(uint8_t state)
+{
+	if (state == STEPPER_MOTOR_POWER_HOLD)
+	{
+		// Pass the M1PWM6 and M1PWM7 signals to the PF2 and PF3 pins
+		// by setting Bits 3 to 2 in the AFSEL register
+		GPIO_PORT_F->AFSEL |= 0x0C;
+	}
+	else
+	{
+		// Drive the PF3 and PF2 pins as GPIO pins
+		// by clearing Bits 3 to 2 in the AFSEL register
+		GPIO_PORT_F->AFSEL &= ~0x0C;
+
+		if (state == STEPPER_MOTOR_POWER_FULL)
+		{
+			// Output the current phase and drive the PF3 and PF2 pins high
+			GPIO_PORT_B->DATA = (GPIO_PORT_B->DATA & ~0x0F) | step_phases[phase_index];
+			GPIO_PORT_F->DATA |= 0x0C;
+		}
+		else
+		{
+			// De-energize the coils by clearing the PB3 - PB0, PF3 and PF2 pins
+			GPIO_PORT_F->DATA &= ~0x0C;
+			GPIO_PORT_B->DATA &= ~0x0F;
+		}
+	}
+
+	power_state = state;
+}
+
 void Stepper_Motor_Init()
 {
-	// Enable the clock to Port B by setting the
-	// R1 bit (Bit 1) in the RCGCGPIO register
-	SYSCTL->RCGCGPIO |= 0x02;
+	phase_index = 0;
+	position = 0;
+	ms_since_step = 0;
+	
+	// Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+	
+	// Enable the clock to Port B and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_B);
 	
 	// Configure the PB0, PB1, PB2, and PB3 pins as output
 	// by setting Bits 3 to 0 in the DIR register
-	GPIOB->DIR |= 0x0F;
+	GPIO_PORT_B->DIR |= 0x0F;
 	
 	// Configure the PB0, PB1, PB2, and PB3 pins to function as
 	// GPIO pins by clearing Bits 3 to 0 in the AFSEL register
-	GPIOB->AFSEL &= ~0x0F;
+	GPIO_PORT_B->AFSEL &= ~0x0F;
 	
 	// Enable the digital functionality for the PB0, PB1, PB2, and PB3 pins
 	// by setting Bits 3 to 0 in the DEN register
-	GPIOB->DEN |= 0x0F;
+	GPIO_PORT_B->DEN |= 0x0F;
 	
-	// Enable the clock to Port F by setting the
-	// R5 bit (Bit 5) in the RCGCGPIO register
-	SYSCTL->RCGCGPIO |= 0x20;
+	// Enable the clock to Port F and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_F);
 	
 	// Configure the PF3 and PF2 pins as output
 	// by setting Bits 3 to 0 in the DIR register
-	GPIOF->DIR |= 0x0C;
+	GPIO_PORT_F->DIR |= 0x0C;
 	
 	// Configure the PF3 and PF2 pins to function as
 	// GPIO pins by clearing Bits 3 to 2 in the AFSEL register
-	GPIOF->AFSEL &= ~0x0C;
+	GPIO_PORT_F->AFSEL &= ~0x0C;
 	
 	// Enable the digital functionality for the PF3 and PF2 pins
 	// by setting Bits 3 to 2 in the DEN register
-	GPIOF->DEN |= 0x0C;
+	GPIO_PORT_F->DEN |= 0x0C;
+	
+	// Configure the PF2 and PF3 pins to operate as Module 1 PWM6 and PWM7 pins (M1PWM6 and M1PWM7)
+	// by writing 0x5 to the PMC2 and PMC3 fields (Bits 15 to 8) in the PCTL register
+	// The pins only output the PWM signals while they are selected in the AFSEL register
+	GPIO_PORT_F->PCTL = (GPIO_PORT_F->PCTL & ~0x0000FF00) | 0x00005500;
+	
+	// Enable the clock to PWM Module 1 and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_PWM, 1);
+	
+	// Disable the Module 1 PWM Generator 3 block (PWM1_3) and use Count-Down mode
+	// by clearing the ENABLE bit (Bit 0) and the MODE bit (Bit 1) in the PWM3CTL register
+	PWM1->_3_CTL &= ~0x03;
+	
+	// Drive each PWM signal high when the counter matches its comparator while counting down
+	// (ACTCMPAD = 0x3 in PWM3GENA and ACTCMPBD = 0x3 in PWM3GENB)
+	// and low when the counter matches the load value (ACTLOAD = 0x2)
+	PWM1->_3_GENA = 0xC8;
+	PWM1->_3_GENB = 0xC08;
+	
+	// Set the period and the duty cycle of the holding current
+	PWM1->_3_LOAD = (STEPPER_MOTOR_PWM_PERIOD - 1);
+	PWM1->_3_CMPA = hold_duty_cycle;
+	PWM1->_3_CMPB = hold_duty_cycle;
 	
-	// Initialize the output of the PF3 and PF2 pins to high
-	// by setting Bits 3 to 2 in the DATA register
-	GPIOF->DATA |= 0x0C;
+	// Enable the PWM1_3 block and the M1PWM6 and M1PWM7 signals
+	// by setting the PWM6EN and PWM7EN bits (Bits 7 to 6) in the PWMENABLE register
+	PWM1->_3_CTL |= 0x01;
+	PWM1->ENABLE |= 0xC0;
+	
+	// De-energize the coils until the first step
+	Stepper_Motor_Set_Power_State(STEPPER_MOTOR_POWER_OFF);
+}
+
+void Stepper_Motor_Set_Power(uint8_t hold_percent, uint32_t settle_ms, uint32_t idle_ms)
+{
+	if (hold_percent == 0 || hold_percent > 100) return;
+
+	hold_duty_cycle = (uint16_t)((STEPPER_MOTOR_PWM_PERIOD * (uint32_t)hold_percent) / 100);
+
+	// A comparator value equal to the load value would never be matched
+	if (hold_duty_cycle >= STEPPER_MOTOR_PWM_PERIOD)
+	{
+		hold_duty_cycle = STEPPER_MOTOR_PWM_PERIOD - 1;
+	}
+
+	PWM1->_3_CMPA = hold_duty_cycle;
+	PWM1->_3_CMPB = hold_duty_cycle;
+
+	settle_time_ms = settle_ms;
+	idle_time_ms = idle_ms;
+}
+
+void Stepper_Motor_Step(int8_t direction)
+{
+	// The power state is also updated by Stepper_Motor_Tick
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	// Re-energize the coils from the current phase before moving to the next one
+	if (power_state != STEPPER_MOTOR_POWER_FULL)
+	{
+		Stepper_Motor_Set_Power_State(STEPPER_MOTOR_POWER_FULL);
+	}
+
+	if (direction > 0)
+	{
+		phase_index = (phase_index + 1) & 0x03;
+		position = position + 1;
+	}
+	else
+	{
+		phase_index = (phase_index + 3) & 0x03;
+		position = position - 1;
+	}
+
+	GPIO_PORT_B->DATA = (GPIO_PORT_B->DATA & ~0x0F) | step_phases[phase_index];
+	ms_since_step = 0;
+
+	__set_PRIMASK(primask);
+}
+
+void Stepper_Motor_Tick(void)
+{
+	if (power_state == STEPPER_MOTOR_POWER_OFF) return;
+
+	ms_since_step = ms_since_step + 1;
+
+	if (power_state == STEPPER_MOTOR_POWER_FULL && ms_since_step >= settle_time_ms)
+	{
+		Stepper_Motor_Set_Power_State(STEPPER_MOTOR_POWER_HOLD);
+	}
+
+	if (power_state == STEPPER_MOTOR_POWER_HOLD && idle_time_ms != 0 && ms_since_step >= idle_time_ms)
+	{
+		Stepper_Motor_Set_Power_State(STEPPER_MOTOR_POWER_OFF);
+	}
+}
+
+int32_t Stepper_Motor_Get_Position(void)
+{
+	return position;
+}
+
+uint8_t Stepper_Motor_Get_Power_State(void)
+{
+	return power_state;
 }
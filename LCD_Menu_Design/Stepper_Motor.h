@@ -11,16 +11,112 @@
  *  - ULN2003 Stepper Motor Driver
  *  - 3.3V / 5V Breadboard Power Supply Module (External Power Source)
  *
+ * The coil phases are driven by the PB0 - PB3 pins, and the power of the coils is controlled by the PF2 and PF3 pins.
+ * The driver manages the power of the coils with the following states:
+ *  - Full:  PF2 and PF3 are driven high while the motor is moving
+ *  - Hold:  PF2 and PF3 output a PWM signal (M1PWM6 and M1PWM7) that reduces the holding current,
+ *           once no step has been taken for the settle time
+ *  - Off:   The coils are de-energized once no step has been taken for the idle timeout
+ *
+ * The position and the current phase are kept while the coils are de-energized. The next step
+ * re-energizes the coils from the same phase, so the position is not lost.
+ *
+ * @note Stepper_Motor_Tick must be called every 1 ms (e.g. from the Timer 0A periodic task).
+ * The driver does not own a timer, so without the tick the coils remain at the full current after a step
+ * and are never switched to the holding current or de-energized.
+ *
+ * @note This driver takes over PWM Module 1 Generator 3 (M1PWM6 on PF2 and M1PWM7 on PF3). It cannot be used
+ * at the same time as the PWM1_3 driver (PWM1_3_Init) or the RGB LED on the LaunchPad (PF2 and PF3 are the blue
+ * and green LEDs), since they share the same generator and pins.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz and that the PWM clock
+ * is not divided (PWM_Clock_Init is not used), which results in a PWM frequency of 20 kHz.
+ *
  * @author Aaron Nanas
  */
 
 #include "TM4C123GH6PM.h"
 
+// Period of the PWM signal used to reduce the holding current (in PWM clock cycles)
+#define STEPPER_MOTOR_PWM_PERIOD            2500
+
+// Default holding current (in percent of the full current)
+#define STEPPER_MOTOR_DEFAULT_HOLD_PERCENT  30
+
+// Default time without steps before the holding current is reduced (in ms)
+#define STEPPER_MOTOR_DEFAULT_SETTLE_MS     50
+
+// Default time without steps before the coils are de-energized (in ms)
+#define STEPPER_MOTOR_DEFAULT_IDLE_MS       2000
+
+enum Stepper_Motor_Power_States
+{
+	STEPPER_MOTOR_POWER_OFF     = 0x00,
+	STEPPER_MOTOR_POWER_FULL    = 0x01,
+	STEPPER_MOTOR_POWER_HOLD    = 0x02
+};
+
 /**
- * @brief
+ * @brief Initializes the pins used by the stepper motor and the PWM signals used to reduce the holding current.
+ *
+ * The coils are de-energized until the first step is taken. The position is set to 0.
  *
  * @param None
  *
  * @return None
  */
 void Stepper_Motor_Init();
+
+/**
+ * @brief Sets the holding current and the timeouts of the coil power states.
+ *
+ * @param hold_percent The holding current in percent of the full current (1 - 100).
+ *
+ * @param settle_ms The time without steps before the holding current is reduced (in ms).
+ *
+ * @param idle_ms The time without steps before the coils are de-energized (in ms).
+ *                It must be greater than settle_ms, or 0 to keep the holding current indefinitely.
+ *
+ * @return None
+ */
+void Stepper_Motor_Set_Power(uint8_t hold_percent, uint32_t settle_ms, uint32_t idle_ms);
+
+/**
+ * @brief Moves the stepper motor by one full step.
+ *
+ * The coils are driven with the full current and the settle and idle timeouts are restarted.
+ *
+ * @param direction 1 to move clockwise or -1 to move counterclockwise.
+ *
+ * @return None
+ */
+void Stepper_Motor_Step(int8_t direction);
+
+/**
+ * @brief Updates the power state of the coils based on the time elapsed since the last step.
+ *
+ * @param None
+ *
+ * @return None
+ *
+ * @note This function must be called every 1 ms. The settle time and the idle timeout are counted in calls.
+ */
+void Stepper_Motor_Tick(void);
+
+/**
+ * @brief Returns the position of the stepper motor.
+ *
+ * @param None
+ *
+ * @return The number of steps taken clockwise since initialization (negative if counterclockwise).
+ */
+int32_t Stepper_Motor_Get_Position(void);
+
+/**
+ * @brief Returns the power state of the coils.
+ *
+ * @param None
+ *
+ * @return The power state (e.g. STEPPER_MOTOR_POWER_HOLD).
+ */
+uint8_t Stepper_Motor_Get_Power_State(void);
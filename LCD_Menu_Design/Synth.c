@@ -0,0 +1,414 @@
+/**
+ * @file Synth.c
+ *
+ * @brief Source code for the Synth driver.
+ *
+ * This file contains the function definitions for the Synth driver.
+ * It plays up to four notes at the same time on the DMT-1206 Magnetic Buzzer using direct digital synthesis (DDS).
+ *
+ * Each voice has a 32-bit phase accumulator that indexes a 256-entry wavetable (sine, square or sawtooth)
+ * stored in flash, and an envelope (attack, decay, sustain and release) that scales its amplitude.
+ * Timer 4A interrupts the CPU once per sample. The interrupt service routine advances every active voice,
+ * mixes them and writes the result to the comparator of the PWM signal on the buzzer pin (PC4, M0PWM6),
+ * which acts as a digital-to-analog converter. The envelopes are updated once every millisecond
+ * from the same interrupt service routine.
+ *
+ * The Timer 4A interrupt uses priority level 2, so the 1 ms periodic task of Timer 0A (priority level 1)
+ * can preempt it. The number of CPU cycles spent in each sample is measured with the DWT cycle counter
+ * and can be compared with the number of cycles available per sample.
+ *
+ * @note The Buzzer driver (Buzzer_Init and Play_Note) must not be used together with this driver
+ * because both drivers use the PC4 pin.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz and that the PWM clock
+ * is not divided (PWM_Clock_Init is not used), which results in a PWM frequency of 48.8 kHz.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "Synth.h"
+#include "Clock_Manager.h"
+#include "GPIO.h"
+
+#define SYSTEM_CLOCK_HZ     50000000UL
+
+// Rate at which the envelopes are updated (in Hz)
+#define ENVELOPE_RATE_HZ    1000
+
+// The envelope level is stored in Q16 format, where the integer part (0 - 255) is the gain applied to the voice
+#define ENVELOPE_MAX_LEVEL  (255UL << 16)
+
+enum Envelope_Stages
+{
+	ENVELOPE_IDLE       = 0x00,
+	ENVELOPE_ATTACK     = 0x01,
+	ENVELOPE_DECAY      = 0x02,
+	ENVELOPE_SUSTAIN    = 0x03,
+	ENVELOPE_RELEASE    = 0x04
+};
+
+typedef struct
+{
+	uint32_t phase;
+	uint32_t phase_increment;
+	const int8_t* wavetable;
+	volatile uint8_t stage;
+	uint32_t level;
+	uint32_t attack_step;
+	uint32_t decay_step;
+	uint32_t sustain_level;
+	uint32_t release_step;
+} Synth_Voice;
+
+// One cycle of each waveform (indexed by Synth_Waveforms)
+static const int8_t wavetables[SYNTH_WAVEFORM_COUNT][256] =
+{
+	{
+		   0,    3,    6,    9,   12,   16,   19,   22,   25,   28,   31,   34,   37,   40,   43,   46,
+		  49,   51,   54,   57,   60,   63,   65,   68,   71,   73,   76,   78,   81,   83,   85,   88,
+		  90,   92,   94,   96,   98,  100,  102,  104,  106,  107,  109,  111,  112,  113,  115,  116,
+		 117,  118,  120,  121,  122,  122,  123,  124,  125,  125,  126,  126,  126,  127,  127,  127,
+		 127,  127,  127,  127,  126,  126,  126,  125,  125,  124,  123,  122,  122,  121,  120,  118,
+		 117,  116,  115,  113,  112,  111,  109,  107,  106,  104,  102,  100,   98,   96,   94,   92,
+		  90,   88,   85,   83,   81,   78,   76,   73,   71,   68,   65,   63,   60,   57,   54,   51,
+		  49,   46,   43,   40,   37,   34,   31,   28,   25,   22,   19,   16,   12,    9,    6,    3,
+		   0,   -3,   -6,   -9,  -12,  -16,  -19,  -22,  -25,  -28,  -31,  -34,  -37,  -40,  -43,  -46,
+		 -49,  -51,  -54,  -57,  -60,  -63,  -65,  -68,  -71,  -73,  -76,  -78,  -81,  -83,  -85,  -88,
+		 -90,  -92,  -94,  -96,  -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+		-117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+		-127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+		-117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100,  -98,  -96,  -94,  -92,
+		 -90,  -88,  -85,  -83,  -81,  -78,  -76,  -73,  -71,  -68,  -65,  -63,  -60,  -57,  -54,  -51,
+		 -49,  -46,  -43,  -40,  -37,  -34,  -31,  -28,  -25,  -22,  -19,  -16,  -12,   -9,   -6,   -3
+	},
+	{
+		 127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+		 127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+		 127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+		 127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+		 127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+		 127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+		 127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+		 127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+		-127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		-127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		-127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		-127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		-127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		-127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		-127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127,
+		-127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127, -127
+	},
+	{
+		-127, -126, -125, -124, -123, -122, -121, -120, -119, -118, -117, -116, -115, -114, -113, -112,
+		-111, -110, -109, -108, -107, -106, -105, -104, -103, -102, -101, -100,  -99,  -98,  -97,  -96,
+		 -95,  -94,  -93,  -92,  -91,  -90,  -89,  -88,  -87,  -86,  -85,  -84,  -83,  -82,  -81,  -80,
+		 -79,  -78,  -77,  -76,  -75,  -74,  -73,  -72,  -71,  -70,  -69,  -68,  -67,  -66,  -65,  -64,
+		 -63,  -62,  -61,  -60,  -59,  -58,  -57,  -56,  -55,  -54,  -53,  -52,  -51,  -50,  -49,  -48,
+		 -47,  -46,  -45,  -44,  -43,  -42,  -41,  -40,  -39,  -38,  -37,  -36,  -35,  -34,  -33,  -32,
+		 -31,  -30,  -29,  -28,  -27,  -26,  -25,  -24,  -23,  -22,  -21,  -20,  -19,  -18,  -17,  -16,
+		 -15,  -14,  -13,  -12,  -11,  -10,   -9,   -8,   -7,   -6,   -5,   -4,   -3,   -2,   -1,    0,
+		   0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,   11,   12,   13,   14,   15,
+		  16,   17,   18,   19,   20,   21,   22,   23,   24,   25,   26,   27,   28,   29,   30,   31,
+		  32,   33,   34,   35,   36,   37,   38,   39,   40,   41,   42,   43,   44,   45,   46,   47,
+		  48,   49,   50,   51,   52,   53,   54,   55,   56,   57,   58,   59,   60,   61,   62,   63,
+		  64,   65,   66,   67,   68,   69,   70,   71,   72,   73,   74,   75,   76,   77,   78,   79,
+		  80,   81,   82,   83,   84,   85,   86,   87,   88,   89,   90,   91,   92,   93,   94,   95,
+		  96,   97,   98,   99,  100,  101,  102,  103,  104,  105,  106,  107,  108,  109,  110,  111,
+		 112,  113,  114,  115,  116,  117,  118,  119,  120,  121,  122,  123,  124,  125,  126,  127
+	}
+};
+
+static Synth_Voice voices[SYNTH_VOICES];
+
+static uint32_t sample_rate = SYNTH_DEFAULT_SAMPLE_RATE_HZ;
+static uint32_t samples_per_envelope_update = SYNTH_DEFAULT_SAMPLE_RATE_HZ / ENVELOPE_RATE_HZ;
+static uint32_t samples_until_envelope_update = 1;
+static volatile uint32_t master_volume = 255;
+
+static uint32_t budget_cycles = 0;
+static volatile uint32_t last_cycles = 0;
+static volatile uint32_t max_cycles = 0;
+
+// Returns the change of the envelope level per update for a stage of the specified duration
+static uint32_t Synth_Envelope_Step(uint32_t duration_ms)
+{
+	if (duration_ms == 0) return ENVELOPE_MAX_LEVEL;
+
+	uint32_t step = ENVELOPE_MAX_LEVEL / ((duration_ms * ENVELOPE_RATE_HZ) / 1000);
+	return (step > 0) ? step : 1;
+}
+
+// Advances the envelope of every voice by one update
+static void Synth_Update_Envelopes(void)
+{
+	for (uint8_t i = 0; i < SYNTH_VOICES; i++)
+	{
+		Synth_Voice* voice = &voices[i];
+
+		switch (voice->stage)
+		{
+			case ENVELOPE_ATTACK:
+			{
+				if (voice->level + voice->attack_step >= ENVELOPE_MAX_LEVEL)
+				{
+					voice->level = ENVELOPE_MAX_LEVEL;
+					voice->stage = ENVELOPE_DECAY;
+				}
+				else
+				{
+					voice->level = voice->level + voice->attack_step;
+				}
+				break;
+			}
+
+			case ENVELOPE_DECAY:
+			{
+				if (voice->level <= voice->sustain_level + voice->decay_step)
+				{
+					voice->level = voice->sustain_level;
+					voice->stage = ENVELOPE_SUSTAIN;
+				}
+				else
+				{
+					voice->level = voice->level - voice->decay_step;
+				}
+				break;
+			}
+
+			case ENVELOPE_RELEASE:
+			{
+				if (voice->level <= voice->release_step)
+				{
+					voice->level = 0;
+					voice->stage = ENVELOPE_IDLE;
+				}
+				else
+				{
+					voice->level = voice->level - voice->release_step;
+				}
+				break;
+			}
+
+			default:
+			{
+				break;
+			}
+		}
+	}
+}
+
+void Synth_Init(uint32_t sample_rate_hz)
+{
+	if (sample_rate_hz < 1000)
+	{
+		sample_rate_hz = 1000;
+	}
+	else if (sample_rate_hz > 48000)
+	{
+		sample_rate_hz = 48000;
+	}
+
+	sample_rate = sample_rate_hz;
+	samples_per_envelope_update = sample_rate_hz / ENVELOPE_RATE_HZ;
+	samples_until_envelope_update = samples_per_envelope_update;
+	budget_cycles = SYSTEM_CLOCK_HZ / sample_rate_hz;
+	master_volume = 255;
+	last_cycles = 0;
+	max_cycles = 0;
+
+	for (uint8_t i = 0; i < SYNTH_VOICES; i++)
+	{
+		voices[i].stage = ENVELOPE_IDLE;
+		voices[i].level = 0;
+		voices[i].phase = 0;
+		voices[i].phase_increment = 0;
+		voices[i].wavetable = wavetables[SYNTH_WAVEFORM_SINE];
+		Synth_Set_Envelope(i, 10, 100, 192, 200);
+	}
+
+	// Enable the DWT cycle counter used to measure the cost of each sample
+	// by setting the TRCENA bit (Bit 24) in the DEMCR register and the CYCCNTENA bit (Bit 0) in the DWT CTRL register
+	CoreDebug->DEMCR |= (1UL << 24);
+	DWT->CTRL |= 0x01;
+
+	// Select the aperture (AHB or APB) used to access the GPIO ports
+	GPIO_Aperture_Init();
+
+	// Enable the clocks to PWM Module 0 and Port C and wait until they are ready to be accessed
+	Clock_Manager_Acquire(CLOCK_PWM, 0);
+	Clock_Manager_Acquire(CLOCK_GPIO, CLOCK_GPIO_PORT_C);
+
+	// Configure the PC4 pin to use the alternate function (M0PWM6)
+	// by setting Bit 4 in the AFSEL register
+	GPIO_PORT_C->AFSEL |= 0x10;
+
+	// Configure the PC4 pin to operate as a Module 0 PWM6 pin (M0PWM6)
+	// by writing 0x4 to the PMC4 field (Bits 19 to 16) in the PCTL register
+	GPIO_PORT_C->PCTL = (GPIO_PORT_C->PCTL & ~0x000F0000) | 0x00040000;
+
+	// Enable the digital functionality for the PC4 pin
+	// by setting Bit 4 in the DEN register
+	GPIO_PORT_C->DEN |= 0x10;
+
+	// Disable the Module 0 PWM Generator 3 block (PWM0_3) and use Count-Down mode
+	// by clearing the ENABLE bit (Bit 0) and the MODE bit (Bit 1) in the PWM3CTL register
+	PWM0->_3_CTL &= ~0x03;
+
+	// Drive the PWM signal high when the counter matches the comparator while counting down (ACTCMPAD = 0x3)
+	// and low when the counter matches the load value (ACTLOAD = 0x2)
+	PWM0->_3_GENA = 0xC8;
+
+	// Set the period and start at the midpoint, which corresponds to silence
+	PWM0->_3_LOAD = (SYNTH_PWM_PERIOD - 1);
+	PWM0->_3_CMPA = (SYNTH_PWM_PERIOD / 2);
+
+	// Enable the PWM0_3 block and pass the M0PWM6 signal to the PC4 pin
+	// by setting the PWM6EN bit (Bit 6) in the PWMENABLE register
+	PWM0->_3_CTL |= 0x01;
+	PWM0->ENABLE |= 0x40;
+
+	// Enable the clock for Timer 4A and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_TIMER, 4);
+
+	// Disable Timer 4A, select the 32-bit timer configuration and the Periodic Timer Mode
+	TIMER4->CTL &= ~0x01;
+	TIMER4->CFG = 0x00;
+	TIMER4->TAMR = 0x02;
+
+	// Generate one interrupt per sample
+	TIMER4->TAILR = budget_cycles - 1;
+
+	// Clear the time-out interrupt flag and enable the time-out interrupt
+	TIMER4->ICR = 0x01;
+	TIMER4->IMR = 0x01;
+
+	// Set the priority level to 2 for the Timer 4A interrupt (IRQ 70)
+	// Timer 0A is set to priority level 1 by Timer_0A_Interrupt_Init and preempts the audio interrupt
+	NVIC_SetPriority(TIMER4A_IRQn, 2);
+
+	// Enable IRQ 70 for Timer 4A by setting Bit 6 in the ISER[2] register
+	NVIC->ISER[2] |= (1 << 6);
+
+	// Enable Timer 4A
+	TIMER4->CTL |= 0x01;
+}
+
+void Synth_Note_On(uint8_t voice, double frequency, uint8_t waveform)
+{
+	if (voice >= SYNTH_VOICES || waveform >= SYNTH_WAVEFORM_COUNT) return;
+
+	// The phase advances by (frequency / sample rate) of a cycle on every sample
+	uint32_t phase_increment = (uint32_t)((frequency * 4294967296.0) / (double)sample_rate);
+
+	// The voice is updated by the Timer 4A interrupt service routine
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	voices[voice].phase = 0;
+	voices[voice].phase_increment = phase_increment;
+	voices[voice].wavetable = wavetables[waveform];
+	voices[voice].level = 0;
+	voices[voice].stage = ENVELOPE_ATTACK;
+
+	__set_PRIMASK(primask);
+}
+
+void Synth_Note_Off(uint8_t voice)
+{
+	if (voice >= SYNTH_VOICES) return;
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	if (voices[voice].stage != ENVELOPE_IDLE)
+	{
+		voices[voice].stage = ENVELOPE_RELEASE;
+	}
+
+	__set_PRIMASK(primask);
+}
+
+void Synth_Set_Envelope(uint8_t voice, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain_level, uint16_t release_ms)
+{
+	if (voice >= SYNTH_VOICES) return;
+
+	uint32_t primask = __get_PRIMASK();
+	__disable_irq();
+
+	voices[voice].attack_step = Synth_Envelope_Step(attack_ms);
+	voices[voice].decay_step = Synth_Envelope_Step(decay_ms);
+	voices[voice].sustain_level = ((uint32_t)sustain_level << 16);
+	voices[voice].release_step = Synth_Envelope_Step(release_ms);
+
+	__set_PRIMASK(primask);
+}
+
+void Synth_Set_Volume(uint8_t volume)
+{
+	master_volume = volume;
+}
+
+uint8_t Synth_Is_Active(uint8_t voice)
+{
+	if (voice >= SYNTH_VOICES) return 0;
+
+	return (voices[voice].stage != ENVELOPE_IDLE);
+}
+
+uint32_t Synth_Get_Budget_Cycles(void)
+{
+	return budget_cycles;
+}
+
+uint32_t Synth_Get_Last_Cycles(void)
+{
+	return last_cycles;
+}
+
+uint32_t Synth_Get_Max_Cycles(void)
+{
+	return max_cycles;
+}
+
+void TIMER4A_Handler(void)
+{
+	uint32_t start_cycles = DWT->CYCCNT;
+
+	// Acknowledge the Timer 4A interrupt and clear it
+	TIMER4->ICR = 0x01;
+
+	int32_t mix = 0;
+
+	for (uint8_t i = 0; i < SYNTH_VOICES; i++)
+	{
+		Synth_Voice* voice = &voices[i];
+
+		if (voice->stage != ENVELOPE_IDLE)
+		{
+			// The upper 8 bits of the phase accumulator select the wavetable entry
+			voice->phase = voice->phase + voice->phase_increment;
+			mix = mix + (voice->wavetable[voice->phase >> 24] * (int32_t)(voice->level >> 16));
+		}
+	}
+
+	// Scale the mix of the four voices (-32768 to 32767) by the master volume
+	mix = ((mix / SYNTH_VOICES) * (int32_t)master_volume) >> 8;
+
+	// Convert the mix to a duty cycle centered at half of the PWM period
+	PWM0->_3_CMPA = ((uint32_t)(mix + 32768) * (SYNTH_PWM_PERIOD - 1)) >> 16;
+
+	samples_until_envelope_update = samples_until_envelope_update - 1;
+	if (samples_until_envelope_update == 0)
+	{
+		samples_until_envelope_update = samples_per_envelope_update;
+		Synth_Update_Envelopes();
+	}
+
+	// Record the cost of this sample
+	last_cycles = DWT->CYCCNT - start_cycles;
+	if (last_cycles > max_cycles)
+	{
+		max_cycles = last_cycles;
+	}
+}
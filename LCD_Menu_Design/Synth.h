@@ -0,0 +1,148 @@
+/**
+ * @file Synth.h
+ *
+ * @brief Header file for the Synth driver.
+ *
+ * This file contains the function definitions for the Synth driver.
+ * It plays up to four notes at the same time on the DMT-1206 Magnetic Buzzer using direct digital synthesis (DDS).
+ *
+ * Each voice has a 32-bit phase accumulator that indexes a 256-entry wavetable (sine, square or sawtooth)
+ * stored in flash, and an envelope (attack, decay, sustain and release) that scales its amplitude.
+ * Timer 4A interrupts the CPU once per sample. The interrupt service routine advances every active voice,
+ * mixes them and writes the result to the comparator of the PWM signal on the buzzer pin (PC4, M0PWM6),
+ * which acts as a digital-to-analog converter. The envelopes are updated once every millisecond
+ * from the same interrupt service routine.
+ *
+ * The Timer 4A interrupt uses priority level 2, so the 1 ms periodic task of Timer 0A (priority level 1)
+ * can preempt it. The number of CPU cycles spent in each sample is measured with the DWT cycle counter
+ * and can be compared with the number of cycles available per sample.
+ *
+ * @note The Buzzer driver (Buzzer_Init and Play_Note) must not be used together with this driver
+ * because both drivers use the PC4 pin.
+ *
+ * @note This driver assumes that the system clock's frequency is 50 MHz and that the PWM clock
+ * is not divided (PWM_Clock_Init is not used), which results in a PWM frequency of 48.8 kHz.
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include "TM4C123GH6PM.h"
+
+#define SYNTH_VOICES                    4
+
+#define SYNTH_DEFAULT_SAMPLE_RATE_HZ    16000
+
+// Period of the PWM signal (in PWM clock cycles), which sets the resolution of the output
+#define SYNTH_PWM_PERIOD                1024
+
+enum Synth_Waveforms
+{
+	SYNTH_WAVEFORM_SINE         = 0x00,
+	SYNTH_WAVEFORM_SQUARE       = 0x01,
+	SYNTH_WAVEFORM_SAWTOOTH     = 0x02,
+	SYNTH_WAVEFORM_COUNT        = 0x03
+};
+
+/**
+ * @brief Initializes the PWM output on the PC4 pin and the Timer 4A sample interrupt.
+ *
+ * Every voice is silent and uses a default envelope (attack 10 ms, decay 100 ms, sustain 75%, release 200 ms).
+ * The master volume is set to the maximum.
+ *
+ * @param sample_rate_hz The number of samples generated per second (1000 - 48000).
+ *
+ * @return None
+ */
+void Synth_Init(uint32_t sample_rate_hz);
+
+/**
+ * @brief Starts a note on a voice.
+ *
+ * The phase of the voice is reset and the envelope restarts from the attack stage.
+ *
+ * @param voice The index of the voice (0 - 3).
+ *
+ * @param frequency The frequency of the note in Hz (e.g. A4_NOTE).
+ *
+ * @param waveform The waveform of the voice (e.g. SYNTH_WAVEFORM_SINE).
+ *
+ * @return None
+ */
+void Synth_Note_On(uint8_t voice, double frequency, uint8_t waveform);
+
+/**
+ * @brief Releases the note played by a voice.
+ *
+ * The voice becomes silent once its envelope has completed the release stage.
+ *
+ * @param voice The index of the voice (0 - 3).
+ *
+ * @return None
+ */
+void Synth_Note_Off(uint8_t voice);
+
+/**
+ * @brief Sets the envelope of a voice.
+ *
+ * The envelope is used by the next note started on the voice.
+ *
+ * @param voice The index of the voice (0 - 3).
+ *
+ * @param attack_ms The time taken to rise from silence to the maximum level (in ms).
+ *
+ * @param decay_ms The time taken to fall from the maximum level to the sustain level (in ms).
+ *
+ * @param sustain_level The level held while the note is on (0 - 255).
+ *
+ * @param release_ms The time taken to fall from the maximum level to silence after the note is released (in ms).
+ *
+ * @return None
+ */
+void Synth_Set_Envelope(uint8_t voice, uint16_t attack_ms, uint16_t decay_ms, uint8_t sustain_level, uint16_t release_ms);
+
+/**
+ * @brief Sets the master volume applied to the mix of all voices.
+ *
+ * @param volume The master volume (0 - 255).
+ *
+ * @return None
+ */
+void Synth_Set_Volume(uint8_t volume);
+
+/**
+ * @brief Indicates whether a voice is producing sound.
+ *
+ * @param voice The index of the voice (0 - 3).
+ *
+ * @return Returns 1 if the voice is active (including the release stage). Otherwise, it returns 0.
+ */
+uint8_t Synth_Is_Active(uint8_t voice);
+
+/**
+ * @brief Returns the number of CPU cycles available for each sample.
+ *
+ * @param None
+ *
+ * @return The number of CPU cycles between two samples.
+ */
+uint32_t Synth_Get_Budget_Cycles(void);
+
+/**
+ * @brief Returns the number of CPU cycles spent in the last sample.
+ *
+ * @param None
+ *
+ * @return The number of CPU cycles.
+ */
+uint32_t Synth_Get_Last_Cycles(void);
+
+/**
+ * @brief Returns the largest number of CPU cycles spent in one sample.
+ *
+ * This includes the samples in which the envelopes are updated.
+ *
+ * @param None
+ *
+ * @return The number of CPU cycles.
+ */
+uint32_t Synth_Get_Max_Cycles(void);
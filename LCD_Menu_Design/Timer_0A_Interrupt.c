@@ -19,6 +19,7 @@
  */
 
 #include "Timer_0A_Interrupt.h"
+#include "Clock_Manager.h"
 
 // Declare pointer to the user-defined task
 void (*Timer_0A_Task)(void);
@@ -28,9 +29,8 @@ void Timer_0A_Interrupt_Init(void(*task)(void))
 	// Store the user-defined task function for use during interrupt handling
 	Timer_0A_Task = task;
 	
-	// Set the R0 bit (Bit 0) in the RCGCTIMER register
-	// to enable the clock for Timer 0A
-	SYSCTL->RCGCTIMER |=  0x01;
+	// Enable the clock for Timer 0A and wait until it is ready to be accessed
+	Clock_Manager_Acquire(CLOCK_TIMER, 0);
 	
 	// Clear the TAEN bit (Bit 0) of the GPTMCTL register
 	// to disable Timer 0A
@@ -68,10 +68,8 @@ void Timer_0A_Interrupt_Init(void(*task)(void))
 	TIMER0->IMR |= 0x01;
 	
 	// Set the priority level to 1 for the Timer 0A interrupt
-	// In the Interrupt 16-19 Priority (PRI4) register,
-	// the INTD field (Bits 31 to 29) corresponds to Interrupt Request (IRQ) 19
 	// Timer 0A has an IRQ of 19
-	NVIC->IPR[4] = (NVIC->IPR[4] & 0x00FFFFFF) | (1 << 29);
+	NVIC_SetPriority(TIMER0A_IRQn, 1);
 	
 	// Enable IRQ 19 for Timer 0A by setting Bit 19 in the ISER[0] register
 	NVIC->ISER[0] |= (1 << 19);
@@ -0,0 +1,152 @@
+/**
+ * @file asset_store_host.c
+ *
+ * @brief Host tool that reads a flash image through the Asset_Store module.
+ *
+ * This tool uses a file-backed model of the external flash device. Reads beyond the end of the file
+ * return 0xFF, like an erased flash device. It lists the assets of the image and streams each asset
+ * through the block cache in chunks, calling Asset_Store_Prefetch between chunks like the main loop would.
+ * Each chunk is compared with the contents of the file, and the cache statistics are reported.
+ * With --dump, the contents of one asset are written to the standard output instead.
+ *
+ * Usage (from the LCD_Menu_Design directory):
+ *  cc -std=c99 -I. -o asset_store_host Tools/asset_store_host.c Asset_Store.c
+ *  ./asset_store_host assets.bin [chunk size]
+ *  ./asset_store_host assets.bin --dump <id> > asset.bin
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Asset_Store.h"
+
+#define MAX_CHUNK_SIZE      4096
+
+static FILE* flash_file = NULL;
+static uint32_t flash_read_count = 0;
+
+static void File_Flash_Read(uint32_t address, uint8_t* buffer, uint32_t length)
+{
+	size_t count = 0;
+
+	if (fseek(flash_file, (long)address, SEEK_SET) == 0)
+	{
+		count = fread(buffer, 1, length, flash_file);
+	}
+
+	memset(buffer + count, 0xFF, length - count);
+	flash_read_count = flash_read_count + 1;
+}
+
+static Asset_Flash file_flash = {0, File_Flash_Read};
+
+// Streams an asset through the cache and returns 0 if its contents do not match the file
+static int Verify_Asset(uint32_t id, uint32_t chunk_size)
+{
+	static uint8_t chunk[MAX_CHUNK_SIZE];
+	static uint8_t expected[MAX_CHUNK_SIZE];
+	Asset_Handle handle;
+
+	if (!Asset_Store_Open(id, &handle))
+	{
+		printf("%10lu  not found\n", (unsigned long)id);
+		return 0;
+	}
+
+	uint32_t offset = 0;
+	uint32_t count;
+
+	while ((count = Asset_Store_Read(&handle, chunk, chunk_size)) > 0)
+	{
+		File_Flash_Read(handle.address + offset, expected, count);
+		flash_read_count = flash_read_count - 1;
+
+		if (memcmp(chunk, expected, count) != 0)
+		{
+			printf("%10lu  mismatch at offset %lu\n", (unsigned long)id, (unsigned long)offset);
+			return 0;
+		}
+
+		offset = offset + count;
+		Asset_Store_Prefetch();
+	}
+
+	printf("%10lu  0x%08lX  %8lu bytes  ok\n", (unsigned long)id, (unsigned long)handle.address, (unsigned long)handle.length);
+	return 1;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s <image> [chunk size | --dump <id>]\n", argv[0]);
+		return 2;
+	}
+
+	flash_file = fopen(argv[1], "rb");
+	if (flash_file == NULL)
+	{
+		perror(argv[1]);
+		return 2;
+	}
+
+	// Model a flash device of the size selected for the target
+	file_flash.size = 0x400000;
+
+	if (!Asset_Store_Init(&file_flash))
+	{
+		fprintf(stderr, "%s: not a valid asset image\n", argv[1]);
+		return 1;
+	}
+
+	if (argc == 4 && strcmp(argv[2], "--dump") == 0)
+	{
+		Asset_Handle handle;
+		uint8_t chunk[ASSET_STORE_BLOCK_SIZE];
+		uint32_t count;
+
+		if (!Asset_Store_Open((uint32_t)strtoul(argv[3], NULL, 0), &handle))
+		{
+			fprintf(stderr, "asset %s not found\n", argv[3]);
+			return 1;
+		}
+
+		while ((count = Asset_Store_Read(&handle, chunk, sizeof(chunk))) > 0)
+		{
+			fwrite(chunk, 1, count, stdout);
+		}
+		return 0;
+	}
+
+	uint32_t chunk_size = (argc >= 3) ? (uint32_t)strtoul(argv[2], NULL, 0) : 32;
+	if (chunk_size == 0 || chunk_size > MAX_CHUNK_SIZE)
+	{
+		fprintf(stderr, "the chunk size must be between 1 and %d bytes\n", MAX_CHUNK_SIZE);
+		return 2;
+	}
+
+	int failures = 0;
+
+	printf("%10s  %10s  %14s\n", "ID", "Address", "Length");
+	for (uint32_t i = 0; i < Asset_Store_Get_Count(); i++)
+	{
+		if (!Verify_Asset(Asset_Store_Get_ID(i), chunk_size))
+		{
+			failures = failures + 1;
+		}
+	}
+
+	uint32_t hits = Asset_Store_Get_Hit_Count();
+	uint32_t misses = Asset_Store_Get_Miss_Count();
+
+	printf("%lu assets, %d failed\n", (unsigned long)Asset_Store_Get_Count(), failures);
+	printf("Cache: %lu hits, %lu misses (%.1f%% hit rate), %lu read-ahead blocks, %lu flash reads\n",
+		(unsigned long)hits, (unsigned long)misses, (hits + misses) ? (100.0 * hits) / (hits + misses) : 0.0,
+		(unsigned long)Asset_Store_Get_Prefetch_Count(), (unsigned long)flash_read_count);
+
+	fclose(flash_file);
+	return (failures == 0) ? 0 : 1;
+}
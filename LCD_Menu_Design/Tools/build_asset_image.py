@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""
+Builds a flash image for the Asset_Store module from a list of files.
+
+The image starts with the index table (magic, number of assets, and one
+ID/address/length entry per asset sorted by ID), followed by the data of each
+asset aligned to 4 bytes. All words are little-endian. The image can be
+programmed into the external SPI NOR flash, or read on the host with
+Tools/asset_store_host.c.
+
+Usage (from the LCD_Menu_Design directory):
+    python3 Tools/build_asset_image.py assets.bin 1=menu.bin 2=glyphs.bin 16=clip.pcm
+"""
+
+import argparse
+import struct
+import sys
+
+ASSET_STORE_MAGIC = 0x54535341
+INDEX_HEADER_SIZE = 8
+INDEX_ENTRY_SIZE = 12
+ALIGNMENT = 4
+
+
+def parse_asset(argument):
+    asset_id, separator, path = argument.partition("=")
+    if not separator or not path:
+        sys.exit("%s: expected <id>=<file>" % argument)
+    try:
+        asset_id = int(asset_id, 0)
+    except ValueError:
+        sys.exit("%s: the asset ID must be an integer" % argument)
+    if not 0 <= asset_id < 0xFFFFFFFF:
+        sys.exit("%s: the asset ID must be between 0 and 0xFFFFFFFE" % argument)
+    with open(path, "rb") as asset_file:
+        return asset_id, asset_file.read()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("image", help="flash image to be written")
+    parser.add_argument("assets", nargs="+", help="assets given as <id>=<file>")
+    parser.add_argument("--size", type=lambda value: int(value, 0), default=0x400000,
+                        help="size of the flash device in bytes (default: 0x400000)")
+    arguments = parser.parse_args()
+
+    assets = sorted(parse_asset(argument) for argument in arguments.assets)
+    for (first_id, _), (second_id, _) in zip(assets, assets[1:]):
+        if first_id == second_id:
+            sys.exit("asset ID %d is used more than once" % first_id)
+
+    address = INDEX_HEADER_SIZE + len(assets) * INDEX_ENTRY_SIZE
+    index = struct.pack("<II", ASSET_STORE_MAGIC, len(assets))
+    data = b""
+    for asset_id, contents in assets:
+        padding = -address % ALIGNMENT
+        data += b"\xFF" * padding
+        address += padding
+        index += struct.pack("<III", asset_id, address, len(contents))
+        data += contents
+        address += len(contents)
+
+    if address > arguments.size:
+        sys.exit("the image (%d bytes) does not fit in the flash (%d bytes)" % (address, arguments.size))
+
+    with open(arguments.image, "wb") as image:
+        image.write(index + data)
+    print("%s: %d assets, %d bytes" % (arguments.image, len(assets), address))
+
+
+if __name__ == "__main__":
+    main()
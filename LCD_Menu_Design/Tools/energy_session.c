@@ -0,0 +1,190 @@
+/**
+ * @file energy_session.c
+ *
+ * @brief Host tool that estimates the energy of a scripted session.
+ *
+ * This tool reads a session script and reports the current and the accumulated energy for each step,
+ * followed by the time spent in each power mode and the average current. It uses the Energy_Estimator
+ * module of the firmware with the EduBase_TM4C123_Board coefficients.
+ *
+ * Each line of the script contains one of the following commands (# starts a comment):
+ *  - clock <MHz>                       Sets the core clock frequency
+ *  - mode <run | sleep | deep-sleep>   Sets the power mode
+ *  - peripheral <type> <count>         Sets the number of enabled clocks (gpio, timer, wide-timer, ssi, pwm, dma, eeprom, uart)
+ *  - load <led | buzzer | stepper-coil> <count>   Sets the number of active loads
+ *  - wait <us>                         Remains in the present state for the specified time
+ *  - repeat <count> ... end            Repeats the enclosed commands (cannot be nested)
+ *
+ * Usage (from the LCD_Menu_Design directory):
+ *  cc -std=c99 -I. -o energy_session Tools/energy_session.c Energy_Estimator.c
+ *  ./energy_session Tools/sessions/menu_busy_wait.session
+ *
+ * @author LCD_Menu_Design contributors
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Energy_Estimator.h"
+
+#define MAX_LINE_LENGTH     128
+#define MAX_REPEAT_LINES    64
+
+static const char* const mode_names[ENERGY_MODE_COUNT] = {"run", "sleep", "deep-sleep"};
+static const char* const peripheral_names[ENERGY_PERIPHERAL_COUNT] =
+{
+	"gpio", "timer", "wide-timer", "ssi", "pwm", "dma", "eeprom", "uart"
+};
+static const char* const load_names[ENERGY_LOAD_COUNT] = {"led", "buzzer", "stepper-coil"};
+
+static uint8_t verbose = 1;
+static uint64_t session_time_us = 0;
+
+static int Find_Name(const char* const names[], int count, const char* name)
+{
+	for (int i = 0; i < count; i++)
+	{
+		if (strcmp(names[i], name) == 0) return i;
+	}
+	return -1;
+}
+
+// Executes one command and returns 0 if it is not valid
+static int Execute_Command(char* line)
+{
+	char* command = strtok(line, " \t\r\n");
+	char* argument_1 = strtok(NULL, " \t\r\n");
+	char* argument_2 = strtok(NULL, " \t\r\n");
+
+	if (command == NULL || command[0] == '#') return 1;
+
+	if (strcmp(command, "clock") == 0 && argument_1 != NULL)
+	{
+		Energy_Estimator_Set_Core_Clock((uint32_t)strtoul(argument_1, NULL, 10));
+	}
+	else if (strcmp(command, "mode") == 0 && argument_1 != NULL)
+	{
+		int mode = Find_Name(mode_names, ENERGY_MODE_COUNT, argument_1);
+		if (mode < 0) return 0;
+		Energy_Estimator_Set_Power_Mode((uint8_t)mode);
+	}
+	else if (strcmp(command, "peripheral") == 0 && argument_2 != NULL)
+	{
+		int peripheral = Find_Name(peripheral_names, ENERGY_PERIPHERAL_COUNT, argument_1);
+		if (peripheral < 0) return 0;
+		Energy_Estimator_Set_Peripheral_Count((uint8_t)peripheral, (uint8_t)atoi(argument_2));
+	}
+	else if (strcmp(command, "load") == 0 && argument_2 != NULL)
+	{
+		int load = Find_Name(load_names, ENERGY_LOAD_COUNT, argument_1);
+		if (load < 0) return 0;
+		Energy_Estimator_Set_Load((uint8_t)load, (uint8_t)atoi(argument_2));
+	}
+	else if (strcmp(command, "wait") == 0 && argument_1 != NULL)
+	{
+		uint32_t time_us = (uint32_t)strtoul(argument_1, NULL, 10);
+		Energy_Estimator_Advance(time_us);
+		session_time_us = session_time_us + time_us;
+
+		if (verbose)
+		{
+			printf("%12.3f ms  %9.3f mA  %12.3f mJ\n", session_time_us / 1000.0,
+				Energy_Estimator_Get_Current_uA() / 1000.0, Energy_Estimator_Get_Energy_uJ() / 1000.0);
+		}
+	}
+	else
+	{
+		return 0;
+	}
+
+	return 1;
+}
+
+int main(int argc, char* argv[])
+{
+	char line[MAX_LINE_LENGTH];
+	char repeat_lines[MAX_REPEAT_LINES][MAX_LINE_LENGTH];
+	int repeat_line_count = 0;
+	long repeat_count = -1;
+	int line_number = 0;
+
+	if (argc < 2)
+	{
+		fprintf(stderr, "usage: %s <session> [--summary]\n", argv[0]);
+		return 1;
+	}
+
+	FILE* session = fopen(argv[1], "r");
+	if (session == NULL)
+	{
+		perror(argv[1]);
+		return 1;
+	}
+
+	verbose = !(argc > 2 && strcmp(argv[2], "--summary") == 0);
+
+	Energy_Estimator_Init(&EduBase_TM4C123_Board);
+
+	if (verbose)
+	{
+		printf("%15s  %12s  %15s\n", "Time", "Current", "Energy");
+	}
+
+	while (fgets(line, sizeof(line), session) != NULL)
+	{
+		char command[MAX_LINE_LENGTH];
+		line_number = line_number + 1;
+
+		if (sscanf(line, "%127s", command) != 1) continue;
+
+		if (strcmp(command, "repeat") == 0)
+		{
+			if (repeat_count >= 0 || sscanf(line, "%*s %ld", &repeat_count) != 1) goto invalid;
+			repeat_line_count = 0;
+		}
+		else if (strcmp(command, "end") == 0)
+		{
+			if (repeat_count < 0) goto invalid;
+
+			for (long i = 0; i < repeat_count; i++)
+			{
+				for (int j = 0; j < repeat_line_count; j++)
+				{
+					char copy[MAX_LINE_LENGTH];
+					strcpy(copy, repeat_lines[j]);
+					if (!Execute_Command(copy)) goto invalid;
+				}
+			}
+			repeat_count = -1;
+		}
+		else if (repeat_count >= 0)
+		{
+			// The enclosed commands are recorded and executed when the end of the block is reached
+			if (repeat_line_count >= MAX_REPEAT_LINES) goto invalid;
+			strcpy(repeat_lines[repeat_line_count], line);
+			repeat_line_count = repeat_line_count + 1;
+		}
+		else if (!Execute_Command(line))
+		{
+			goto invalid;
+		}
+	}
+
+	fclose(session);
+
+	printf("\nSession: %.3f ms, %.3f mJ, average current %.3f mA\n", session_time_us / 1000.0,
+		Energy_Estimator_Get_Energy_uJ() / 1000.0, Energy_Estimator_Get_Average_Current_uA() / 1000.0);
+
+	for (uint8_t mode = 0; mode < ENERGY_MODE_COUNT; mode++)
+	{
+		printf("  %-10s %12.3f ms\n", mode_names[mode], Energy_Estimator_Get_Mode_Time_us(mode) / 1000.0);
+	}
+
+	return 0;
+
+invalid:
+	fprintf(stderr, "%s:%d: invalid command\n", argv[1], line_number);
+	fclose(session);
+	return 1;
+}
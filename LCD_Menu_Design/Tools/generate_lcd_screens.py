@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+"""
+Compiles the static screen definitions in LCD_Screens.def into LCD command streams.
+
+Each screen is emitted as a const uint8_t array (placed in flash) that can be sent
+with EduBase_LCD_Send_Stream. The stream uses the following records:
+    LCD_STREAM_COMMAND <command>
+    LCD_STREAM_DATA    <length> <data bytes>
+    LCD_STREAM_END
+
+Usage (from the LCD_Menu_Design directory):
+    python3 Tools/generate_lcd_screens.py
+"""
+
+import os
+import shlex
+import sys
+
+LCD_STREAM_END = 0x00
+LCD_STREAM_COMMAND = 0x01
+LCD_STREAM_DATA = 0x02
+
+CLEAR_DISPLAY = 0x01
+SET_DDRAM_ADDR = 0x80
+
+# The HD44780 stores 40 characters per row; the second row starts at DDRAM address 0x40
+DDRAM_ROW_LENGTH = 40
+DDRAM_ROW_OFFSETS = (0x00, 0x40)
+
+PROJECT_DIR = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def parse_definitions(path):
+    screens = []
+    with open(path, encoding="ascii") as definitions:
+        for line_number, line in enumerate(definitions, 1):
+            tokens = shlex.split(line, comments=True)
+            if not tokens:
+                continue
+
+            def fail(message):
+                sys.exit("%s:%d: %s" % (path, line_number, message))
+
+            if tokens[0] == "screen" and len(tokens) == 2:
+                screens.append((tokens[1], []))
+            elif tokens[0] == "text" and len(tokens) == 4:
+                if not screens:
+                    fail("text must follow a screen")
+                row, col = int(tokens[1]), int(tokens[2])
+                text = tokens[3].encode("ascii").decode("unicode_escape").encode("latin-1")
+                if row not in (0, 1):
+                    fail("row must be 0 or 1")
+                if col + len(text) > DDRAM_ROW_LENGTH or len(text) > 255:
+                    fail("text does not fit in the DDRAM row")
+                screens[-1][1].append((row, col, text))
+            else:
+                fail("unrecognized definition: %s" % line.strip())
+    return screens
+
+
+def compile_screen(items):
+    stream = [LCD_STREAM_COMMAND, CLEAR_DISPLAY]
+    for row, col, text in items:
+        stream += [LCD_STREAM_COMMAND, SET_DDRAM_ADDR | (DDRAM_ROW_OFFSETS[row] + col)]
+        stream += [LCD_STREAM_DATA, len(text)] + list(text)
+    stream.append(LCD_STREAM_END)
+    return stream
+
+
+def file_banner(name, brief):
+    return (
+        "/**\n"
+        " * @file %s\n"
+        " *\n"
+        " * @brief %s\n"
+        " *\n"
+        " * This file contains the precompiled command streams for the static screens\n"
+        " * of the EduBase Board 16x2 Liquid Crystal Display (LCD). Each stream can be sent\n"
+        " * with a single call to EduBase_LCD_Send_Stream.\n"
+        " *\n"
+        " * @note This file is generated by Tools/generate_lcd_screens.py from LCD_Screens.def.\n"
+        " * Do not edit it manually.\n"
+        " */\n\n" % (name, brief)
+    )
+
+
+def main():
+    screens = parse_definitions(os.path.join(PROJECT_DIR, "LCD_Screens.def"))
+
+    header = file_banner("LCD_Screens.h", "Header file for the precompiled LCD screens.")
+    header += '#include "TM4C123GH6PM.h"\n\n'
+
+    source = file_banner("LCD_Screens.c", "Source code for the precompiled LCD screens.")
+    source += '#include "LCD_Screens.h"\n'
+
+    for name, items in screens:
+        stream = compile_screen(items)
+        symbol = "LCD_SCREEN_" + name
+        header += "extern const uint8_t %s[%d];\n" % (symbol, len(stream))
+
+        source += "\nconst uint8_t %s[%d] =\n{\n" % (symbol, len(stream))
+        index = 0
+        while index < len(stream):
+            record = stream[index]
+            if record == LCD_STREAM_DATA:
+                length = stream[index + 1]
+                text = bytes(stream[index + 2:index + 2 + length])
+                values = stream[index:index + 2 + length]
+                comment = "// " + text.decode("latin-1").encode("unicode_escape").decode("ascii")
+                index += 2 + length
+            elif record == LCD_STREAM_COMMAND:
+                values = stream[index:index + 2]
+                comment = "// Clear Display" if values[1] == CLEAR_DISPLAY else "// Set DDRAM Address"
+                index += 2
+            else:
+                values = [record]
+                comment = "// End"
+                index += 1
+            last = index == len(stream)
+            source += "\t" + ", ".join("0x%02X" % value for value in values)
+            source += ("" if last else ",") + " " + comment + "\n"
+        source += "};\n"
+
+    with open(os.path.join(PROJECT_DIR, "LCD_Screens.h"), "w", encoding="ascii", newline="\n") as output:
+        output.write(header)
+    with open(os.path.join(PROJECT_DIR, "LCD_Screens.c"), "w", encoding="ascii", newline="\n") as output:
+        output.write(source)
+
+
+if __name__ == "__main__":
+    main()
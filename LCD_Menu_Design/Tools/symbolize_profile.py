@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+"""
+Maps the samples recorded by the Profiler driver to function names.
+
+The samples are read from a dump of the profiler_samples buffer, either as an
+Intel HEX file (saved with the uVision SAVE command) or as a raw binary file.
+Each sample holds the stacked PC followed by the stacked LR (little-endian).
+Empty samples (PC = 0) are ignored.
+
+The symbols are read from the linker map file (Image Symbol Table) or from the
+ELF image (.axf). The LR of a sample usually points into the caller of the
+sampled function, so it is reported as the caller.
+
+Usage (from the LCD_Menu_Design directory):
+    python3 Tools/symbolize_profile.py profile.hex Listings/LCD_Menu_Design.map
+    python3 Tools/symbolize_profile.py profile.bin Objects/LCD_Menu_Design.axf --callers
+"""
+
+import argparse
+import bisect
+import collections
+import re
+import struct
+import sys
+
+MAP_SYMBOL = re.compile(r"^\s+(\S+)\s+0x([0-9a-fA-F]+)\s+(?:Thumb|ARM) Code\s+(\d+)\s")
+
+ELF_SECTION_SYMTAB = 2
+ELF_SYMBOL_FUNC = 2
+
+
+def read_map_symbols(path):
+    symbols = []
+    with open(path, encoding="latin-1") as map_file:
+        for line in map_file:
+            match = MAP_SYMBOL.match(line)
+            if match:
+                name, address, size = match.group(1), int(match.group(2), 16), int(match.group(3))
+                symbols.append((address & ~1, size, name))
+    return symbols
+
+
+def read_elf_symbols(path):
+    with open(path, "rb") as elf_file:
+        image = elf_file.read()
+    if image[:4] != b"\x7fELF" or image[4] != 1 or image[5] != 1:
+        sys.exit("%s: not a 32-bit little-endian ELF file" % path)
+
+    section_offset, = struct.unpack_from("<I", image, 0x20)
+    section_size, section_count = struct.unpack_from("<HH", image, 0x2E)
+    sections = [struct.unpack_from("<IIIIIIIIII", image, section_offset + index * section_size)
+                for index in range(section_count)]
+
+    symbols = []
+    for section in sections:
+        if section[1] != ELF_SECTION_SYMTAB:
+            continue
+        strings = sections[section[6]]
+        for offset in range(section[4], section[4] + section[5], section[9]):
+            name_offset, value, size, info = struct.unpack_from("<IIIB", image, offset)
+            if info & 0x0F != ELF_SYMBOL_FUNC:
+                continue
+            start = strings[4] + name_offset
+            name = image[start:image.index(b"\0", start)].decode("latin-1")
+            symbols.append((value & ~1, size, name))
+    return symbols
+
+
+def read_intel_hex(path):
+    memory = {}
+    base = 0
+    with open(path, encoding="ascii") as hex_file:
+        for line in hex_file:
+            line = line.strip()
+            if not line.startswith(":"):
+                continue
+            record = bytes.fromhex(line[1:])
+            length, address, record_type = record[0], (record[1] << 8) | record[2], record[3]
+            data = record[4:4 + length]
+            if record_type == 0x00:
+                for index, value in enumerate(data):
+                    memory[base + address + index] = value
+            elif record_type == 0x04:
+                base = ((data[0] << 8) | data[1]) << 16
+            elif record_type == 0x01:
+                break
+    if not memory:
+        return b""
+    start = min(memory)
+    return bytes(memory.get(address, 0) for address in range(start, max(memory) + 1))
+
+
+def read_samples(path):
+    if path.lower().endswith(".hex"):
+        dump = read_intel_hex(path)
+    else:
+        with open(path, "rb") as dump_file:
+            dump = dump_file.read()
+    samples = []
+    for offset in range(0, len(dump) - 7, 8):
+        pc, lr = struct.unpack_from("<II", dump, offset)
+        if pc != 0:
+            samples.append((pc, lr))
+    return samples
+
+
+class Symbolizer:
+    def __init__(self, symbols):
+        # Keep the largest symbol at each address (aliases are often listed with a size of 0)
+        by_address = {}
+        for address, size, name in symbols:
+            if address not in by_address or size > by_address[address][0]:
+                by_address[address] = (size, name)
+        self.addresses = sorted(by_address)
+        self.symbols = [by_address[address] for address in self.addresses]
+
+    def lookup(self, address):
+        address &= ~1
+        index = bisect.bisect_right(self.addresses, address) - 1
+        if index < 0:
+            return "<unknown 0x%08X>" % address
+        size, name = self.symbols[index]
+        if size != 0 and address >= self.addresses[index] + size:
+            return "<unknown 0x%08X>" % address
+        return name
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("samples", help="dump of profiler_samples (.hex or raw binary)")
+    parser.add_argument("symbols", help="linker map file (.map) or ELF image (.axf)")
+    parser.add_argument("--callers", action="store_true", help="list the callers of each function")
+    parser.add_argument("--top", type=int, default=20, help="number of functions to list")
+    arguments = parser.parse_args()
+
+    if arguments.symbols.lower().endswith(".map"):
+        symbolizer = Symbolizer(read_map_symbols(arguments.symbols))
+    else:
+        symbolizer = Symbolizer(read_elf_symbols(arguments.symbols))
+
+    samples = read_samples(arguments.samples)
+    if not samples:
+        sys.exit("%s: no samples found" % arguments.samples)
+
+    functions = collections.Counter()
+    callers = collections.defaultdict(collections.Counter)
+    for pc, lr in samples:
+        function = symbolizer.lookup(pc)
+        functions[function] += 1
+        # EXC_RETURN values (0xFFFFFFxx) indicate that the sampled code is an exception handler
+        caller = "<exception return>" if lr >= 0xFFFFFF00 else symbolizer.lookup(lr)
+        callers[function][caller] += 1
+
+    print("%d samples" % len(samples))
+    print("%8s %7s  %s" % ("Samples", "Percent", "Function"))
+    for function, count in functions.most_common(arguments.top):
+        print("%8d %6.2f%%  %s" % (count, 100.0 * count / len(samples), function))
+        if arguments.callers:
+            for caller, caller_count in callers[function].most_common(3):
+                print("%8s %7s    from %s (%d)" % ("", "", caller, caller_count))
+
+
+if __name__ == "__main__":
+    main()
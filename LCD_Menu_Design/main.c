@@ -9,6 +9,14 @@
  *	- EduBase Board 16x2 Liquid Crystal Display (LCD)
  *  - PMOD ENC Module (Rotary Encoder)
  *
+ * The main menu is rendered directly to the LCD by default. It can be rendered to another
+ * display by defining DISPLAY_BACKEND (see Display_Backend.h) in the project options.
+ *
+ * The last selected menu item is stored in the EEPROM and is shown again after a reset.
+ * Define PROFILER_ENABLE as 1 to record a profile of the main menu (see Profiler.h).
+ * Define GPIO_BENCHMARK_ENABLE as 1 to show the GPIO toggle rate and the LCD nibble throughput
+ * on the APB and AHB apertures at startup (see GPIO_Benchmark.h).
+ *
  * @note For more information regarding the LCD, refer to the HD44780 LCD Controller Datasheet.
  * Link: https://www.sparkfun.com/datasheets/LCD/HD44780.pdf
  *
@@ -19,19 +27,54 @@
 
 #include "SysTick_Delay.h"
 #include "EduBase_LCD.h"
+#include "LCD_Screens.h"
+#include "Display_Backend.h"
+#include "LCD_Page_Cache.h"
+#include "Seven_Segment_Display.h"
 
 #include "PMOD_ENC.h"
 #include "Timer_0A_Interrupt.h"
+#include "Render_Scheduler.h"
+#include "Gesture.h"
+#include "Standby.h"
+#include "Settings.h"
+#include "Interrupt_Guard.h"
+#include "Profiler.h"
+#include "GPIO_Benchmark.h"
 
 #include "GPIO.h"
 
 #define MAX_COUNT 7
 
+// Maximum number of times per second the main menu is redrawn
+#define MAX_FRAME_RATE 20
+
+// Time without any activity on the PMOD ENC module before entering standby (in ms)
+#define STANDBY_TIMEOUT_MS 30000
+
+// Index of the PMOD ENC button in the gesture engine
+#define GESTURE_INPUT_PMOD_ENC_BUTTON 0
+
 static uint8_t state = 0;
 static uint8_t last_state = 0;
-static uint8_t pmod_enc_btn_pressed = 0;
-static int prev_main_menu_counter = 0xFF;
-static int main_menu_counter = 0;
+static volatile int main_menu_counter = 0;
+static volatile uint32_t idle_ms = 0;
+
+// Direction of the last rotation (1 or -1), used to predict the next menu item
+static volatile int last_direction = 1;
+
+// Precompiled screen shown for each value of main_menu_counter
+static const uint8_t* const main_menu_screens[MAX_COUNT + 1] =
+{
+	LCD_SCREEN_MAIN_MENU_TURN_OFF_LEDS,
+	LCD_SCREEN_MAIN_MENU_TURN_ON_LEDS,
+	LCD_SCREEN_MAIN_MENU_TURN_ON_LEDS,
+	LCD_SCREEN_MAIN_MENU_FLASH_LEDS,
+	LCD_SCREEN_MAIN_MENU_FLASH_LEDS,
+	LCD_SCREEN_MAIN_MENU_HEART_SEQUENCE,
+	LCD_SCREEN_MAIN_MENU_HEART_SEQUENCE,
+	LCD_SCREEN_MAIN_MENU_DISPLAY_INFO
+};
 
 void PMOD_ENC_Task(void);
 
@@ -39,9 +82,10 @@ void PMOD_ENC_Task(void);
 * @brief Reads the state of the PMOD ENC module every 1 ms.
 *
 * The PMOD_ENC_Task function is called when the Timer 0A module triggers a periodic interrupt
-* every 1 ms. It reads the state of the PMOD ENC module. It sets the pmod_enc_btn_pressed flag
-* if the button is pressed. In addition, it increments or decrements the global variable, main_menu_counter,
-* depending on the direction of the rotary encoder's rotation. This is used to indicate the active item on the LCD menu.
+* every 1 ms. It reads the state of the PMOD ENC module and passes the state of the button to the gesture engine.
+* In addition, it increments or decrements the global variable, main_menu_counter, depending on the direction
+* of the rotary encoder's rotation unless the rotation is part of a press and rotate gesture.
+* This is used to indicate the active item on the LCD menu.
 * 
 * @param None
 *
@@ -60,10 +104,56 @@ void PMOD_ENC_Task(void);
 void Display_Main_Menu(int main_menu_state);
 
 /**
-* @brief Handles main menu selection whenever the PMOD ENC button is pressed
+* @brief Redraws the main menu with the latest value of main_menu_counter.
+*
+* This function is executed by the render scheduler, which limits the number of redraws
+* to MAX_FRAME_RATE per second and coalesces any rotations that occur in between.
+*
+* @param None
+*
+* @return None
+*/
+void Render_Main_Menu(void);
+
+/**
+* @brief Pre-renders the next main menu item in the direction of the last rotation.
+*
+* This function is called from the main loop while no frame needs to be rendered. The item is written
+* into the off-screen DDRAM of the LCD a few characters at a time, so that it can be shown by shifting the display.
+*
+* @param None
+*
+* @return None
+*/
+void Prefetch_Main_Menu(void);
+
+/**
+* @brief Writes any changed settings to the EEPROM and turns off the LCD before entering standby.
+*
+* The contents of the LCD are retained while the display is disabled.
+*
+* @param None
+*
+* @return None
+*/
+void Standby_Enter_Task(void);
+
+/**
+* @brief Turns on the LCD after waking up from standby and requests a redraw of the main menu.
 *
-* This function calls corresponding functions based on the menu item selected when
-* the button on the PMOD ENC module is pressed.
+* @param None
+*
+* @return None
+*/
+void Standby_Wake_Task(void);
+
+/**
+* @brief Handles the gestures performed with the PMOD ENC button
+*
+* This function reads one event from the gesture engine. A short press or double click
+* calls the corresponding functions based on the menu item selected and stores the menu item
+* as the default screen. A long press returns to the first menu item, and a press and rotate gesture
+* jumps to the first or last menu item.
 *
 * @param None
 *
@@ -83,30 +173,85 @@ int main(void)
 	EduBase_LCD_Create_Custom_Character(HEART_SHAPE_LOCATION, heart_shape);
 	EduBase_LCD_Create_Custom_Character(RIGHT_ARROW_LOCATION, right_arrow);
 	
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_EDUBASE_LCD
+	//Initialize the page cache used to switch between the main menu items
+	LCD_Page_Cache_Init();
+#endif
+	
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_SEVEN_SEGMENT
+	//Initialize the Seven-Segment Display used to render the main menu
+	Seven_Segment_Display_Init();
+#elif DISPLAY_BACKEND == DISPLAY_BACKEND_MULTIPLE
+	//Render the main menu to the LCD and mirror it to the memory backend
+	Display_Add_Backend(&EduBase_LCD_Display_Backend);
+	Display_Add_Backend(&Memory_Display_Backend);
+#endif
+	
 	//Initialize the LEDs on the EduBase board (Port B)
 	EduBase_LEDs_Init();
 	
+#if GPIO_BENCHMARK_ENABLE
+	//Show the toggle rate and the LCD nibble throughput (in kHz) on each aperture for 3 seconds
+	GPIO_Benchmark_Result apb_result;
+	GPIO_Benchmark_Result ahb_result;
+	char benchmark_row[17];
+	
+	GPIO_Benchmark_Run(&apb_result, &ahb_result);
+	
+	EduBase_LCD_Clear_Display();
+	sprintf(benchmark_row, "APB %5luk %5luk", (unsigned long)(apb_result.toggle_rate_hz / 1000), (unsigned long)(apb_result.nibble_rate_hz / 1000));
+	EduBase_LCD_Display_String(benchmark_row);
+	EduBase_LCD_Set_Cursor(0, 1);
+	sprintf(benchmark_row, "AHB %5luk %5luk", (unsigned long)(ahb_result.toggle_rate_hz / 1000), (unsigned long)(ahb_result.nibble_rate_hz / 1000));
+	EduBase_LCD_Display_String(benchmark_row);
+	SysTick_Delay1ms(3000);
+	EduBase_LCD_Clear_Display();
+#endif
+	
 	//Initialize the PMOD ENC (Rotary Encoder) module
 	PMOD_ENC_Init();	
 	
+	//Load the settings from the EEPROM and start from the default screen
+	Settings_Init();
+	main_menu_counter = (int)Settings_Get(SETTING_DEFAULT_SCREEN);
+	
+	//Initialize the gesture engine used to recognize the PMOD ENC button gestures
+	Gesture_Init();
+	
+	//Initialize the standby mode that is entered after STANDBY_TIMEOUT_MS without activity
+	Standby_Init(&Standby_Enter_Task, &Standby_Wake_Task);
+	
+	//Initialize the render scheduler used to redraw the main menu
+	Render_Scheduler_Init(&Render_Main_Menu, MAX_FRAME_RATE);
+	
 	//Initialize Timer 0A to generate periodic interrupts every 1 ms
 	//and read the state of the PMOD ENC module
 	Timer_0A_Interrupt_Init(&PMOD_ENC_Task);
 	
+#if PROFILER_ENABLE
+	//Sample the code executed while navigating the main menu
+	Profiler_Init(PROFILER_DEFAULT_RATE_HZ);
+	Profiler_Start();
+#endif
+	
 	//Read the state of the PMOD ENC module and assign the value to last_state
 	last_state = PMOD_ENC_Get_State();
 	
 	while(1)
 	{
-		if (prev_main_menu_counter != main_menu_counter)
+		if (!Render_Scheduler_Run())
 		{
-			EduBase_LCD_Clear_Display();
-			Display_Main_Menu(main_menu_counter); 
-			prev_main_menu_counter = main_menu_counter;
+			Prefetch_Main_Menu();
 		}
 		
 		Process_Main_Menu_Selection();
-		SysTick_Delay1ms(100);
+		Settings_Run();
+		
+		if (idle_ms >= STANDBY_TIMEOUT_MS)
+		{
+			Standby_Enter();
+			idle_ms = 0;
+		}
 	}
 }
 
@@ -114,83 +259,135 @@ void PMOD_ENC_Task(void)
 {
 	state = PMOD_ENC_Get_State();
 
-	if (PMOD_ENC_Button_Read(state) && !PMOD_ENC_Button_Read(last_state))
+	Gesture_Input_Update(GESTURE_INPUT_PMOD_ENC_BUTTON, PMOD_ENC_Button_Read(state));
+
+	int rotation = PMOD_ENC_Get_Rotation(state, last_state);
+
+	//A rotation while the button is held is reported as a press and rotate gesture instead
+	if (Gesture_Input_Rotate(GESTURE_INPUT_PMOD_ENC_BUTTON, rotation))
 	{
-		pmod_enc_btn_pressed = 1;
+		rotation = 0;
 	}
+	
+	if (rotation != 0)
+	{
+		last_direction = rotation;
+	}
+
+	int next_main_menu_counter = main_menu_counter + rotation;
 
-	if (main_menu_counter < 0)
+	if (next_main_menu_counter < 0)
 	{
-		main_menu_counter = 0;
+		next_main_menu_counter = 0;
 	}
-	else if (main_menu_counter > MAX_COUNT)
+	else if (next_main_menu_counter > MAX_COUNT)
 	{
-		main_menu_counter = MAX_COUNT;
+		next_main_menu_counter = MAX_COUNT;
 	}
-	else
+	
+	//Only request a redraw if the active menu item has changed
+	if (next_main_menu_counter != main_menu_counter)
+	{
+		main_menu_counter = next_main_menu_counter;
+		Render_Scheduler_Mark_Dirty();
+	}
+	
+	//Restart the standby timeout whenever a pin of the PMOD ENC module changes
+	if (state != last_state)
+	{
+		idle_ms = 0;
+	}
+	else if (idle_ms < STANDBY_TIMEOUT_MS)
 	{
-		main_menu_counter = main_menu_counter + PMOD_ENC_Get_Rotation(state, last_state);
+		idle_ms = idle_ms + 1;
 	}
 	
 	last_state = state;
+	
+	//Advance the time base of the gesture engine, the render scheduler, the settings write-back
+	//and the interrupt storm detection of the button interrupts
+	Gesture_Tick();
+	Render_Scheduler_Tick();
+	Settings_Tick();
+	Interrupt_Guard_Tick();
+	
+	//Keep the digits of a multiplexed display visible
+	Display_Refresh();
 }
 
 
 void Display_Main_Menu(int main_menu_state)
 {
-	switch(main_menu_state)
+	// Each menu item is a precompiled stream that clears the display
+	// and writes the item at its DDRAM address
+	// On the LCD, the page cache only sends the commands needed to change from the visible item
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_EDUBASE_LCD
+	LCD_Page_Cache_Show(main_menu_screens[main_menu_state]);
+#else
+	Display_Put_Stream(main_menu_screens[main_menu_state]);
+	Display_Flush();
+#endif
+}
+
+void Render_Main_Menu(void)
+{
+	Display_Main_Menu(main_menu_counter);
+}
+
+void Prefetch_Main_Menu(void)
+{
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_EDUBASE_LCD
+	int direction = last_direction;
+	int next = main_menu_counter;
+	const uint8_t* current_screen = main_menu_screens[next];
+	
+	//Skip the menu items that share the current screen
+	while (next >= 0 && next <= MAX_COUNT && main_menu_screens[next] == current_screen)
 	{
-		case 0x00:
-		{
-			//Setting (0,0) -> (0, 2) allowed me to visualize the top LCD screen than 0
-			EduBase_LCD_Set_Cursor(0, 2);
-			EduBase_LCD_Display_String("TURN OFF LEDS");
-			
-			break;
-		}
-		
-		case 0x01:
-		case 0x02:
-		{
-			EduBase_LCD_Set_Cursor(0, 1);
-			EduBase_LCD_Display_String("TURN ON LEDS");
-			
-			break;
-		}
-		
-		case 0x03:
-		case 0x04:
-		{
-			EduBase_LCD_Set_Cursor(0, 2);
-			EduBase_LCD_Display_String("FLASH LEDS");
-		}
-		
-		case 0x05:
-		case 0x06:
-		{
-			EduBase_LCD_Set_Cursor(0, 1);
-			EduBase_LCD_Display_String("HEART SEQUENCE");
-			
-			break;
-		}
-		
-		case 0x07:
-		{
-			EduBase_LCD_Set_Cursor(0, 2);
-			EduBase_LCD_Display_String("DISPLAY INFO");
-			
-			break;
-		}
+		next = next + direction;
 	}
+	
+	if (next >= 0 && next <= MAX_COUNT)
+	{
+		LCD_Page_Cache_Prefetch(main_menu_screens[next]);
+	}
+#endif
+}
+
+void Standby_Enter_Task(void)
+{
+	Settings_Flush();
+	EduBase_LCD_Disable_Display();
+}
+
+void Standby_Wake_Task(void)
+{
+	EduBase_LCD_Enable_Display();
+	Render_Scheduler_Mark_Dirty();
 }
 
 
 void Process_Main_Menu_Selection(void)
 {
-	if (pmod_enc_btn_pressed == 1)
+	Gesture_Event event;
+	
+	if (!Gesture_Get_Event(&event)) return;
+	
+	if (event.gesture == GESTURE_LONG_PRESS)
+	{
+		main_menu_counter = 0;
+		Render_Scheduler_Mark_Dirty();
+	}
+	
+	else if (event.gesture == GESTURE_PRESS_AND_ROTATE)
+	{
+		main_menu_counter = (event.rotation > 0) ? MAX_COUNT : 0;
+		Render_Scheduler_Mark_Dirty();
+	}
+	
+	else
 	{
-		pmod_enc_btn_pressed = 0;
-		prev_main_menu_counter = 0xFF;
+		Settings_Set(SETTING_DEFAULT_SCREEN, (uint32_t)main_menu_counter);
 		
 		switch(main_menu_counter)
 		{
@@ -226,10 +423,7 @@ void Process_Main_Menu_Selection(void)
 				for (int i = 0; i < 3; i++)
 				{
 					EduBase_LCD_Enable_Display();
-				  EduBase_LCD_Clear_Display();
-					
-					EduBase_LCD_Set_Cursor(0, 1);
-					EduBase_LCD_Send_Data(HEART_SHAPE_LOCATION);
+					EduBase_LCD_Send_Stream(LCD_SCREEN_HEART);
 					
 					SysTick_Delay1ms(3000);
 					EduBase_LCD_Clear_Display();
@@ -241,15 +435,20 @@ void Process_Main_Menu_Selection(void)
 			case 0x07:
 			{
 				EduBase_LCD_Enable_Display();
-				EduBase_LCD_Clear_Display();
-				
-				EduBase_LCD_Set_Cursor(0, 1);
-				EduBase_LCD_Display_String("ECE 425 Microprocessor");
+				EduBase_LCD_Send_Stream(LCD_SCREEN_INFO);
 				
 				SysTick_Delay1ms(3000);
 				EduBase_LCD_Clear_Display();
 				break;
 			}
 		}
+		
+		//Redraw the main menu after the selected action has finished
+		//The action may have written to the LCD directly
+#if DISPLAY_BACKEND == DISPLAY_BACKEND_EDUBASE_LCD
+		LCD_Page_Cache_Invalidate();
+#endif
+		Display_Invalidate();
+		Render_Scheduler_Mark_Dirty();
 	}
 }